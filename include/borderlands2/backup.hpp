@@ -0,0 +1,69 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_BACKUP_HPP
+#define BORDERLANDSSAVEEDITOR_BACKUP_HPP
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for zip backups of save directories.
+             */
+            namespace Backup {
+
+                /*!
+                 * @brief Packs all files of a save directory into a zip archive.
+                 *
+                 * @details The files are read and deflated in parallel on worker threads. The compressed entries
+                 *  are handed to libzip as already compressed data, so they are only copied into the archive
+                 *  when it is written. An existing archive at archive_path is replaced.
+                 *
+                 * @param[in] save_directory The steamid directory holding the saves, sub directories are skipped.
+                 * @param[in] archive_path The path of the zip archive to write.
+                 * @param[in] threads The number of worker threads, 0 uses one per hardware thread.
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API backupSaves(const std::string &save_directory,
+                                                              const std::string &archive_path,
+                                                              unsigned int threads = 0) noexcept(false);
+
+                /*!
+                 * @brief Lists the saves in a backup.
+                 *
+                 * @param[in] archive_path The zip archive to read.
+                 * @param[out] names The names of the entries.
+                 * @return true on success, false if the archive can not be opened.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API listBackup(const std::string &archive_path,
+                                                             std::vector<std::string> *names) noexcept(false);
+
+                /*!
+                 * @brief Restores saves from a backup.
+                 *
+                 * @details Only the requested entries are decompressed. Every restored file is written to a
+                 *  temporary file first and renamed, so an existing save is never left half written.
+                 *
+                 * @param[in] archive_path The zip archive to read.
+                 * @param[in] save_directory The directory to restore to, it is created if it does not exist.
+                 * @param[in] names The saves to restore, with or without the .sav extension. All entries of
+                 *  the archive are restored if empty.
+                 * @return true if all saves were restored, false if one is missing or could not be written.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API restoreSaves(const std::string &archive_path,
+                                                               const std::string &save_directory,
+                                                               const std::vector<std::string> &names = {}) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_BACKUP_HPP
@@ -8,7 +8,13 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
 #include "borderlands2/bl2_save_editor_exports.hpp"
+#include "common/common.hpp"
+
+class WillowTwoPlayerSaveGame;
 
 /*!
  * @brief Checks if the file at a specific path is a valid Borderlands2 save file.
@@ -21,7 +27,265 @@
  */
 bool BORDERLANDS2_SAVE_EDITOR_API_NO_EXPORT isSaveFile(const std::string &path) noexcept(false);
 
+/*!
+ * @brief Checks if the file at a specific path is a save that can be read and parsed.
+ *
+ * @details Uses a SaveReader of its own, so it may be called from any number of threads at once.
+ *
+ * @param path The path of the save file.
+ * @return true iff the save could be read, else false.
+ */
 bool BORDERLANDS2_SAVE_EDITOR_API verifySave(const std::string &path)  noexcept(false);
 
+namespace D4v3 {
+    namespace Borderlands {
+
+        /*!
+         * @brief Namespace for Borderlands 2 save file handling.
+         */
+        namespace Borderlands2 {
+
+            /*!
+             * @brief The stages of reading a save, in the order they are run.
+             */
+            enum BORDERLANDS2_SAVE_EDITOR_API LoadStage {
+                reading_file,
+                decompressing,
+                huffman_decoding,
+                parsing,
+                finished
+            };
+
+            /*!
+             * @brief The reasons reading a save fails, as returned by SaveReader::check.
+             */
+            enum BORDERLANDS2_SAVE_EDITOR_API SaveError {
+                no_error,
+                /*!
+                 * @brief The path does not lead to a regular file.
+                 */
+                bad_path,
+                /*!
+                 * @brief The file does not have the '.sav' extension.
+                 */
+                bad_extension,
+                /*!
+                 * @brief The file could not be opened or read.
+                 */
+                read_failed,
+                /*!
+                 * @brief The file is too short for its checksum and size fields, or claims an implausibly large
+                 *  decompressed size.
+                 */
+                truncated,
+                sha1_mismatch,
+                lzo_input_overrun,
+                lzo_output_overrun,
+                lzo_lookbehind_overrun,
+                /*!
+                 * @brief Any other LZO decompression error.
+                 */
+                lzo_failed,
+                /*!
+                 * @brief The decompressed data does not start with a valid WSG header, or the header claims more
+                 *  data than its payload can decode to.
+                 */
+                bad_inner_header,
+                /*!
+                 * @brief The Huffman tree or codes run past the end of the encoded payload.
+                 */
+                huffman_overrun,
+                /*!
+                 * @brief The CRC32 of the decoded payload does not match the WSG header.
+                 */
+                inner_hash_mismatch,
+                /*!
+                 * @brief The payload is not a valid WillowTwoPlayerSaveGame message.
+                 */
+                parse_failed
+            };
+
+            /*!
+             * @brief Returns a short description of an error, e.g. for log messages.
+             */
+            BORDERLANDS2_SAVE_EDITOR_API const char *saveErrorName(SaveError error) noexcept;
+
+            /*!
+             * @brief Callback invoked when readSave enters a new stage.
+             *
+             * @details The callback is invoked on the thread that calls readSave.
+             */
+            using LoadProgressCallback = std::function<void(LoadStage stage)>;
+
+            /*!
+             * @brief Reads and decodes save files, keeping its buffers between reads.
+             *
+             * @details All state of a read is held by the reader, the library has no global state besides its
+             *  thread safe logger and tables initialized at load time. Different readers may be used from
+             *  different threads at the same time, a single reader must only be used by one thread at a time.
+             *  Reading many saves with one reader avoids allocating the file and decompression buffers again
+             *  for every save.
+             */
+            class BORDERLANDS2_SAVE_EDITOR_API SaveReader {
+            public:
+                /*!
+                 * @brief Reads and decodes the save file at a specific path.
+                 *
+                 * @details The file is read while its SHA1 checksum is verified, LZO decompressed, the inner WSG
+                 *  payload is Huffman decoded and finally deserialized into the given message.
+                 *
+                 * @param[in] path The path of the save file to read.
+                 * @param[out] save_game The message the decoded save is stored in, may be nullptr to only decode
+                 *  the payload.
+                 * @param[in] progress Optional callback notified at the start of every stage.
+                 * @return true on success, else false.
+                 */
+                bool read(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                          const LoadProgressCallback &progress = nullptr) noexcept(false);
+
+                /*!
+                 * @brief Works like read, the decoded payload is stored in payload instead of the reader.
+                 *
+                 * @param[out] payload The serialized message as stored in the save, may be nullptr.
+                 */
+                bool read(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                          std::vector<uint8_t> *payload, const LoadProgressCallback &progress = nullptr) noexcept(false);
+
+                /*!
+                 * @brief Verifies a save and classifies the failure.
+                 *
+                 * @details Runs the same stages as read, but never throws and never logs, so a corrupt file costs
+                 *  no more than a valid one. Meant for scanning many files, e.g. whole archives.
+                 *
+                 * @param[in] path The path of the save file to check.
+                 * @param[in] parse If false the payload is only decoded and its hash checked, not deserialized.
+                 * @return no_error if the save is valid, else the first failing check.
+                 */
+                SaveError check(const std::string &path, bool parse = true) noexcept;
+
+                /*!
+                 * @brief Returns the payload decoded by the last successful read without a payload argument.
+                 */
+                const std::vector<uint8_t> &payload() const noexcept;
+
+            private:
+                /*!
+                 * @brief Runs all stages of a read without logging.
+                 *
+                 * @throw std::bad_alloc If the sizes claimed by the file can not be allocated.
+                 */
+                SaveError decode(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                 std::vector<uint8_t> *payload, const LoadProgressCallback &progress) noexcept(false);
+
+                std::vector<uint8_t> file_data;
+                std::vector<uint8_t> uncompressed_data;
+                std::vector<uint8_t> decoded_payload;
+            };
+
+            /*!
+             * @brief Encodes and writes save files, keeping its buffers between saves.
+             *
+             * @details Like SaveReader, different writers may be used from different threads at the same time and
+             *  a single writer must only be used by one thread at a time.
+             */
+            class BORDERLANDS2_SAVE_EDITOR_API SaveWriter {
+            public:
+                /*!
+                 * @param[in] endianess The byte order of the inner header. PC saves are little endian, console
+                 *  saves big endian.
+                 */
+                explicit SaveWriter(D4v3::Borderlands::Common::Streams::Endian endianess = D4v3::Borderlands::Common::Streams::Endian::little_endian) noexcept(false);
+
+                /*!
+                 * @brief Encodes a save into the on disk format.
+                 *
+                 * @details This is the inverse of SaveReader::read: the message is serialized and Huffman
+                 *  encoded, wrapped in the WSG inner header, LZO compressed and prefixed with the SHA1 checksum of
+                 *  the compressed data.
+                 *
+                 * @param[in] save_game The save to encode. All required fields have to be set.
+                 * @param[out] output The vector the encoded file is stored in. Existing contents are replaced.
+                 * @return true on success, else false.
+                 */
+                bool encode(const WillowTwoPlayerSaveGame &save_game, std::vector<uint8_t> *output) noexcept(false);
+
+                /*!
+                 * @brief Encodes a save and writes it to a specific path.
+                 *
+                 * @param[in] save_game The save to write.
+                 * @param[in] path The path of the file to write. An existing file is overwritten.
+                 * @return true on success, else false.
+                 */
+                bool write(const WillowTwoPlayerSaveGame &save_game, const std::string &path) noexcept(false);
+
+            private:
+                D4v3::Borderlands::Common::Streams::Endian endianess;
+                std::string serialized;
+                std::vector<uint8_t> uncompressed_data;
+                std::vector<uint8_t> work_memory;
+                std::vector<uint8_t> encoded;
+            };
+
+            /*!
+             * @brief Reads and decodes the save file at a specific path.
+             *
+             * @details The file is read while its SHA1 checksum is verified, LZO decompressed, the inner WSG
+             *  payload is Huffman decoded and finally deserialized into the given message.
+             *
+             * @param[in] path The path of the save file to read.
+             * @param[out] save_game The message the decoded save is stored in.
+             * @param[in] progress Optional callback notified at the start of every stage.
+             * @return true on success, else false.
+             *
+             * @see SaveReader::read, which this calls with a reader of its own.
+             */
+            bool BORDERLANDS2_SAVE_EDITOR_API readSave(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                                       const LoadProgressCallback &progress = nullptr) noexcept(false);
+
+            /*!
+             * @brief Reads and decodes the save file at a specific path and keeps the decoded payload.
+             *
+             * @details Works like readSave, additionally the Huffman decoded protobuf payload the message was
+             *  parsed from is stored in payload. If save_game is nullptr the payload is only decoded, not parsed.
+             *
+             * @param[in] path The path of the save file to read.
+             * @param[out] save_game The message the decoded save is stored in, may be nullptr.
+             * @param[out] payload The serialized message as stored in the save, may be nullptr.
+             * @param[in] progress Optional callback notified at the start of every stage.
+             * @return true on success, else false.
+             */
+            bool BORDERLANDS2_SAVE_EDITOR_API readSave(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                                       std::vector<uint8_t> *payload,
+                                                       const LoadProgressCallback &progress = nullptr) noexcept(false);
+
+            /*!
+             * @brief Encodes a save into the on disk format.
+             *
+             * @details This is the inverse of readSave: the message is serialized and Huffman encoded, wrapped in
+             *  the WSG inner header, LZO compressed and prefixed with the SHA1 checksum of the compressed data.
+             *
+             * @param[in] save_game The save to encode. All required fields have to be set.
+             * @param[out] output The vector the encoded file is stored in. Existing contents are replaced.
+             * @param[in] endianess The byte order of the inner header. PC saves are little endian, console saves
+             *  big endian.
+             * @return true on success, else false.
+             */
+            bool BORDERLANDS2_SAVE_EDITOR_API encodeSave(const WillowTwoPlayerSaveGame &save_game, std::vector<uint8_t> *output,
+                                                         D4v3::Borderlands::Common::Streams::Endian endianess = D4v3::Borderlands::Common::Streams::Endian::little_endian) noexcept(false);
+
+            /*!
+             * @brief Encodes a save with encodeSave and writes it to a specific path.
+             *
+             * @param[in] save_game The save to write.
+             * @param[in] path The path of the file to write. An existing file is overwritten.
+             * @param[in] endianess The byte order of the inner header.
+             * @return true on success, else false.
+             */
+            bool BORDERLANDS2_SAVE_EDITOR_API writeSave(const WillowTwoPlayerSaveGame &save_game, const std::string &path,
+                                                        D4v3::Borderlands::Common::Streams::Endian endianess = D4v3::Borderlands::Common::Streams::Endian::little_endian) noexcept(false);
+        }
+    }
+}
+
 
 #endif //BORDERLANDSSAVEEDITOR_BORDERLANDS2_HPP
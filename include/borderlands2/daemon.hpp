@@ -0,0 +1,248 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_DAEMON_HPP
+#define BORDERLANDSSAVEEDITOR_DAEMON_HPP
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            namespace Missions {
+                class MissionNames;
+            }
+
+            /*!
+             * @brief Namespace for the local decode service, only available on UNIX.
+             *
+             * @details The service listens on a Unix domain socket. Every request and response is one frame: a
+             *  little endian uint32 with the number of bytes that follow, a kind byte and the payload. The kind
+             *  of a request is its RequestType, the kind of a response its ResponseStatus. A connection can send
+             *  any number of requests, each is answered before the next one is read.
+             */
+            namespace Daemon {
+
+                /*!
+                 * @brief Size of the length and kind fields of a frame.
+                 */
+                constexpr size_t frame_header_size = 5;
+
+                /*!
+                 * @brief The largest accepted value of the length field of a frame.
+                 */
+                constexpr uint32_t max_frame_size = 64 * 1024 * 1024;
+
+                /*!
+                 * @brief The requests of the service.
+                 */
+                enum BORDERLANDS2_SAVE_EDITOR_API RequestType : uint8_t {
+                    /*!
+                     * @brief Payload: path of a save. Answer: "Name=Value" lines of the main fields of the save.
+                     */
+                    summary = 1,
+                    /*!
+                     * @brief Payload: path of a save. Answer: the save as JSON, as written by Json::toJson.
+                     */
+                    json = 2,
+                    /*!
+                     * @brief Payload: an inventory serial. Answer: "Name=Value" lines of the decoded serial.
+                     */
+                    serial = 3,
+                    /*!
+                     * @brief Payload: path of a save. Answer: empty, the status tells if the save is valid.
+                     */
+                    verify = 4
+                };
+
+                /*!
+                 * @brief The status of a response.
+                 */
+                enum BORDERLANDS2_SAVE_EDITOR_API ResponseStatus : uint8_t {
+                    ok = 0,
+                    /*!
+                     * @brief The save or serial could not be decoded, the payload is an error message.
+                     */
+                    failed = 1,
+                    /*!
+                     * @brief The request type is unknown, the payload is an error message.
+                     */
+                    bad_request = 2
+                };
+
+                struct BORDERLANDS2_SAVE_EDITOR_API Request {
+                    RequestType type = summary;
+                    std::string payload;
+                };
+
+                struct BORDERLANDS2_SAVE_EDITOR_API Response {
+                    ResponseStatus status = ok;
+                    std::string payload;
+                };
+
+                /*!
+                 * @brief Answers a request, exceptions are answered with ResponseStatus::failed.
+                 */
+                using RequestHandler = std::function<Response(const Request &request)>;
+
+                /*!
+                 * @brief Builds the frame of a request or response.
+                 *
+                 * @param[in] kind The RequestType or ResponseStatus.
+                 * @param[in] payload The payload, at most max_frame_size - 1 bytes.
+                 */
+                std::string BORDERLANDS2_SAVE_EDITOR_API encodeFrame(uint8_t kind, const std::string &payload) noexcept(false);
+
+                /*!
+                 * @brief Reads the header of a frame.
+                 *
+                 * @param[in] header The first frame_header_size bytes of the frame.
+                 * @param[out] kind The kind of the frame.
+                 * @param[out] payload_size The number of payload bytes following the header.
+                 * @return false if the length field is 0 or larger than max_frame_size, else true.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API decodeFrameHeader(const uint8_t *header, uint8_t *kind,
+                                                                    uint32_t *payload_size) noexcept(false);
+
+                /*!
+                 * @brief Decoded saves by path, with the least recently used save evicted first.
+                 *
+                 * @details A cached save is used as long as the size and modification time of its file are
+                 *  unchanged. The missions of all cached saves are interned in one MissionNames. The JSON of a
+                 *  save is only built on the first json request. Not thread safe.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API SaveCache {
+                public:
+                    /*!
+                     * @param[in] capacity The number of saves to keep decoded.
+                     */
+                    explicit SaveCache(size_t capacity = 64) noexcept(false);
+
+                    ~SaveCache();
+
+                    /*!
+                     * @brief Answers a request from the cache, decoding the save on a miss.
+                     */
+                    Response handle(const Request &request) noexcept(false);
+
+                    /*!
+                     * @brief Returns the number of requests answered by a cached save.
+                     */
+                    size_t hits() const noexcept;
+
+                    /*!
+                     * @brief Returns the number of saves decoded.
+                     */
+                    size_t misses() const noexcept;
+
+                private:
+                    struct Entry;
+
+                    /*!
+                     * @brief Returns the entry of a save, decoding it if it is not cached or its file changed.
+                     *
+                     * @return The entry, nullptr if the save could not be read.
+                     */
+                    std::shared_ptr<Entry> load(const std::string &path) noexcept(false);
+
+                    size_t capacity;
+                    size_t hit_count;
+                    size_t miss_count;
+                    std::shared_ptr<Missions::MissionNames> mission_names;
+
+                    /*!
+                     * @brief The cached paths, most recently used first.
+                     */
+                    std::list<std::string> recent;
+                    std::unordered_map<std::string, std::pair<std::shared_ptr<Entry>, std::list<std::string>::iterator>> entries;
+                };
+
+                /*!
+                 * @brief Serves requests on a Unix domain socket from a SaveCache.
+                 *
+                 * @details All connections are served by the thread calling run. A failing request is answered
+                 *  with ResponseStatus::failed and does not affect other requests. The socket is only accessible
+                 *  by the user running the server, who can read any save the server can, so clients are trusted
+                 *  with every path they send.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API Server {
+                public:
+                    /*!
+                     * @param[in] socket_path The path of the socket. An existing socket file is replaced.
+                     * @param[in] capacity The capacity of the SaveCache.
+                     */
+                    explicit Server(const std::string &socket_path, size_t capacity = 64) noexcept(false);
+
+                    /*!
+                     * @param[in] socket_path The path of the socket. An existing socket file is replaced.
+                     * @param[in] handler Answers the requests instead of a SaveCache.
+                     */
+                    Server(const std::string &socket_path, RequestHandler handler) noexcept(false);
+
+                    ~Server();
+
+                    /*!
+                     * @brief Binds the socket with permissions for the owner only, clients can connect afterwards.
+                     *
+                     * @return true on success, else false.
+                     */
+                    bool listen() noexcept(false);
+
+                    /*!
+                     * @brief Serves connections until stop is called.
+                     */
+                    void run() noexcept(false);
+
+                    /*!
+                     * @brief Makes run return, may be called from any thread.
+                     */
+                    void stop() noexcept(false);
+
+                private:
+                    struct Impl;
+                    std::unique_ptr<Impl> impl;
+                };
+
+                /*!
+                 * @brief A connection to a Server.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API Client {
+                public:
+                    explicit Client(const std::string &socket_path) noexcept(false);
+
+                    ~Client();
+
+                    /*!
+                     * @brief Connects to the server.
+                     *
+                     * @return true on success, else false.
+                     */
+                    bool connect() noexcept(false);
+
+                    /*!
+                     * @brief Sends a request and waits for its response.
+                     *
+                     * @return true if a response was received, else false.
+                     */
+                    bool request(const Request &request, Response *response) noexcept(false);
+
+                private:
+                    struct Impl;
+                    std::unique_ptr<Impl> impl;
+                };
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_DAEMON_HPP
@@ -0,0 +1,114 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_DIFF_HPP
+#define BORDERLANDSSAVEEDITOR_DIFF_HPP
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+#include "borderlands2/edit.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for comparing two saves field by field.
+             */
+            namespace Diff {
+
+                enum BORDERLANDS2_SAVE_EDITOR_API ChangeKind {
+                    added,      //!< The field or element only exists in the new save.
+                    removed,    //!< The field or element only exists in the old save.
+                    changed     //!< The field exists in both saves with different values.
+                };
+
+                /*!
+                 * @brief One difference between two saves.
+                 *
+                 * @details Elements of repeated fields with a stable key are named by their key in the path, for
+                 *  example MissionPlaythroughs[0].MissionData[GD_Episode01.M_Ep1_Champion].Status, all other
+                 *  elements by their index.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API Change {
+                    ChangeKind kind = ChangeKind::changed;
+
+                    /*!
+                     * @brief Readable path of the field.
+                     */
+                    std::string path;
+
+                    /*!
+                     * @brief Path of the field in the old save, empty for added fields.
+                     */
+                    Edit::FieldPath old_path;
+
+                    /*!
+                     * @brief Path of the field in the new save, empty for removed fields.
+                     */
+                    Edit::FieldPath new_path;
+
+                    /*!
+                     * @brief The old value in text format, empty for added fields.
+                     */
+                    std::string old_value;
+
+                    /*!
+                     * @brief The new value in text format, empty for removed fields.
+                     */
+                    std::string new_value;
+                };
+
+                /*!
+                 * @brief Compares two saves.
+                 *
+                 * @details Elements of repeated fields are aligned by a stable key where the message has one
+                 *  (mission name, skill name, inventory serial, ...) and by index otherwise, so removing one item
+                 *  from the backpack is one change and not a change for every following item. Elements that only
+                 *  moved are not reported. The saves are walked once and keys are matched with hash maps, the
+                 *  time is linear in the size of the saves.
+                 *
+                 * @param[in] old_save The save to compare from.
+                 * @param[in] new_save The save to compare to.
+                 * @param[out] changes The differences, in the field order of the old save with added elements
+                 *  after the elements of the field they belong to.
+                 */
+                void BORDERLANDS2_SAVE_EDITOR_API diffSaves(const WillowTwoPlayerSaveGame &old_save,
+                                                            const WillowTwoPlayerSaveGame &new_save,
+                                                            std::vector<Change> *changes) noexcept(false);
+
+                /*!
+                 * @brief Builds the edits that turn one save into another.
+                 *
+                 * @details Repeated fields are aligned by key like in diffSaves. If the aligned elements kept
+                 *  their order, unmatched old elements are removed and unmatched new elements are inserted,
+                 *  otherwise the field is edited element by element. Applying the edits in order to old_save with
+                 *  Edit::applyEdits gives a message equal to new_save, reverting them in reverse order gives
+                 *  old_save again.
+                 *
+                 * @param[in] old_save The save the edits apply to.
+                 * @param[in] new_save The save the edits lead to.
+                 * @param[out] edits The edits in the order they have to be applied in.
+                 */
+                void BORDERLANDS2_SAVE_EDITOR_API diffEdits(const WillowTwoPlayerSaveGame &old_save,
+                                                            const WillowTwoPlayerSaveGame &new_save,
+                                                            std::vector<Edit::FieldEdit> *edits) noexcept(false);
+
+                /*!
+                 * @brief Formats changes as text, one line per change.
+                 *
+                 * @details Lines start with + for added, - for removed and ~ for changed fields.
+                 */
+                std::string BORDERLANDS2_SAVE_EDITOR_API formatChanges(const std::vector<Change> &changes) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_DIFF_HPP
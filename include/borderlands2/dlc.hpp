@@ -0,0 +1,143 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_DLC_HPP
+#define BORDERLANDSSAVEEDITOR_DLC_HPP
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <vector>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for the DLCExpansionData of saves.
+             */
+            namespace Dlc {
+
+                /*!
+                 * @brief The decoders for the Data of DLCExpansionData entries, by Tag.
+                 *
+                 * @details Every decoder turns the Data bytes into its own type. The layouts of the expansion data
+                 *  are not part of the save format definitions and none of them is known yet, so the library ships
+                 *  no decoders: this is the extension point a decoder is registered on once the layout of a tag is
+                 *  worked out. Until then Expansions::data gives access to the undecoded bytes.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API ExpansionDecoders {
+                public:
+                    /*!
+                     * @brief Adds the decoder of a tag, replacing an existing one.
+                     *
+                     * @param[in] tag The Tag of the entries the decoder is used for.
+                     * @param[in] decoder Decodes the Data of an entry, returns false if it is malformed.
+                     */
+                    template<typename T>
+                    void add(int32_t tag, std::function<bool(const std::string &data, T *decoded)> decoder) noexcept(false) {
+                        decoders.erase(tag);
+                        decoders.emplace(tag, Entry{std::type_index(typeid(T)),
+                                                    [decoder](const std::string &data) -> std::shared_ptr<const void> {
+                                                        auto decoded = std::make_shared<T>();
+                                                        if (!decoder(data, decoded.get())) {
+                                                            return nullptr;
+                                                        }
+                                                        return decoded;
+                                                    }});
+                    }
+
+                    /*!
+                     * @brief Checks if there is a decoder for a tag.
+                     */
+                    bool knows(int32_t tag) const noexcept(false);
+
+                private:
+                    friend class Expansions;
+
+                    struct Entry {
+                        std::type_index type;
+                        std::function<std::shared_ptr<const void>(const std::string &data)> decode;
+                    };
+
+                    std::map<int32_t, Entry> decoders;
+                };
+
+                /*!
+                 * @brief The expansion data of one save, decoded when it is first requested.
+                 *
+                 * @details Loading a save only keeps the Data bytes. The Data of a tag is decoded by get on the
+                 *  first request and the result, or the failure, is cached together with the bytes it was decoded
+                 *  from, so the expansions nobody looks at are never decoded. A request after the Data of the save
+                 *  was edited finds different bytes and decodes them again instead of returning the stale result.
+                 *  Not thread safe.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API Expansions {
+                public:
+                    /*!
+                     * @param[in] save_game The save the expansion data is read from.
+                     * @param[in] decoders The decoders to use.
+                     */
+                    Expansions(std::shared_ptr<const WillowTwoPlayerSaveGame> save_game,
+                               std::shared_ptr<const ExpansionDecoders> decoders) noexcept(false);
+
+                    /*!
+                     * @brief Returns the tags of the expansion data in the save, in the order of the save.
+                     */
+                    std::vector<int32_t> tags() const noexcept(false);
+
+                    /*!
+                     * @brief Returns the undecoded Data of a tag, nullptr if the save has no data for it.
+                     *
+                     * @details If a tag occurs more than once the first entry is used.
+                     */
+                    const std::string *data(int32_t tag) const noexcept(false);
+
+                    /*!
+                     * @brief Returns the decoded Data of a tag.
+                     *
+                     * @return The decoded data, nullptr if the save has no data for the tag, there is no decoder
+                     *  for it, the decoder produces another type than T or the data is malformed.
+                     */
+                    template<typename T>
+                    std::shared_ptr<const T> get(int32_t tag) const noexcept(false) {
+                        return std::static_pointer_cast<const T>(decode(tag, std::type_index(typeid(T))));
+                    }
+
+                private:
+                    /*!
+                     * @brief Returns the cached result of a tag, decoding it on the first request.
+                     */
+                    std::shared_ptr<const void> decode(int32_t tag, std::type_index type) const noexcept(false);
+
+                    /*!
+                     * @brief The result of a tag and the Data it was decoded from.
+                     */
+                    struct Decoded {
+                        std::string data;
+
+                        /*!
+                         * @brief The decoded data, nullptr if it failed to decode.
+                         */
+                        std::shared_ptr<const void> result;
+                    };
+
+                    std::shared_ptr<const WillowTwoPlayerSaveGame> save_game;
+                    std::shared_ptr<const ExpansionDecoders> decoders;
+                    mutable std::map<int32_t, Decoded> decoded;
+                };
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_DLC_HPP
@@ -0,0 +1,198 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_EDIT_HPP
+#define BORDERLANDSSAVEEDITOR_EDIT_HPP
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+#include "common/common.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for field level edits of a save and their history.
+             */
+            namespace Edit {
+
+                /*!
+                 * @brief One step of a path into a message.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API PathElement {
+                    /*!
+                     * @brief The number of the field in the message the previous step leads to.
+                     */
+                    int32_t field_number;
+
+                    /*!
+                     * @brief The element of a repeated field, -1 for singular fields.
+                     */
+                    int32_t index;
+                };
+
+                /*!
+                 * @brief Path from the WillowTwoPlayerSaveGame root to a field or an element of a repeated field.
+                 */
+                using FieldPath = std::vector<PathElement>;
+
+                /*!
+                 * @brief The value of a field, only the member matching the field type is used.
+                 *
+                 * @details Integral, enum and bool fields use integer, float and double fields use floating.
+                 *  String and bytes fields use bytes, message fields store the serialized message in bytes.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API FieldValue {
+                    /*!
+                     * @brief If a singular field is set. Clearing a field is an edit to a value that is not present.
+                     */
+                    bool present = true;
+                    int64_t integer = 0;
+                    double floating = 0;
+                    std::string bytes;
+                };
+
+                enum BORDERLANDS2_SAVE_EDITOR_API Operation {
+                    set,        //!< Replaces old_value with new_value.
+                    insert,     //!< Inserts new_value into a repeated field at the index of the path.
+                    remove      //!< Removes old_value from a repeated field at the index of the path.
+                };
+
+                /*!
+                 * @brief A change to one field, holding everything needed to apply and revert it.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API FieldEdit {
+                    FieldPath path;
+                    Operation operation = Operation::set;
+                    FieldValue old_value;
+                    FieldValue new_value;
+                };
+
+                /*!
+                 * @brief Reads the current value at a path.
+                 *
+                 * @param[in] save_game The message to read from.
+                 * @param[in] path The field to read.
+                 * @param[out] value The value of the field.
+                 * @return true on success, false if the path does not exist.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API readValue(const WillowTwoPlayerSaveGame &save_game, const FieldPath &path,
+                                                            FieldValue *value) noexcept(false);
+
+                /*!
+                 * @brief Applies an edit, or reverts it if reverse is set.
+                 *
+                 * @return true on success, false if the path does not exist or the value does not fit the field.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API applyEdit(const FieldEdit &edit, WillowTwoPlayerSaveGame *save_game,
+                                                            bool reverse = false) noexcept(false);
+
+                /*!
+                 * @brief Applies a list of edits in order, stopping at the first edit that fails.
+                 *
+                 * @return true if all edits were applied, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API applyEdits(const std::vector<FieldEdit> &edits,
+                                                             WillowTwoPlayerSaveGame *save_game) noexcept(false);
+
+                /*!
+                 * @brief Reads a save, replays edits onto it and writes the result.
+                 *
+                 * @details The edits are replayed onto the message parsed from the original file, which is
+                 *  then serialized as a whole. Unedited fields keep their values, but are encoded again rather
+                 *  than copied from the original file.
+                 *
+                 * @param[in] original_path The save the edits were made on.
+                 * @param[in] edits The edits in the order they were made.
+                 * @param[in] path The path of the file to write, may be the original path.
+                 * @param[in] endianess The byte order of the inner header.
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API replaySave(const std::string &original_path, const std::vector<FieldEdit> &edits,
+                                                             const std::string &path,
+                                                             Common::Streams::Endian endianess = Common::Streams::Endian::little_endian) noexcept(false);
+
+                /*!
+                 * @brief Undo and redo stacks of edits made to a save.
+                 *
+                 * @details Every step stores only the edited field with its old and new value, so its memory
+                 *  is proportional to the edit, not to the save. Undoing or redoing a set costs time proportional
+                 *  to the value. Inserting or removing an element also moves the elements of the repeated field
+                 *  behind it, as protobuf stores repeated fields as arrays.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API EditHistory {
+                public:
+                    /*!
+                     * @param save_game The save the edits are applied to, it has to outlive the history.
+                     */
+                    explicit EditHistory(WillowTwoPlayerSaveGame* save_game) noexcept;
+
+                    /*!
+                     * @brief Sets a field to a new value, the old value is read from the save.
+                     *
+                     * @return true on success, else false and the save is unchanged.
+                     */
+                    bool set(const FieldPath &path, const FieldValue &value) noexcept(false);
+
+                    /*!
+                     * @brief Inserts a new element into a repeated field at the index of the path.
+                     */
+                    bool insert(const FieldPath &path, const FieldValue &value) noexcept(false);
+
+                    /*!
+                     * @brief Removes the element of a repeated field at the index of the path.
+                     */
+                    bool remove(const FieldPath &path) noexcept(false);
+
+                    /*!
+                     * @brief Applies an edit and records it as a new step, the redo stack is cleared.
+                     */
+                    bool apply(FieldEdit edit) noexcept(false);
+
+                    bool canUndo() const noexcept;
+
+                    bool canRedo() const noexcept;
+
+                    /*!
+                     * @brief Reverts the last step.
+                     *
+                     * @return true if a step was reverted, else false.
+                     */
+                    bool undo() noexcept(false);
+
+                    /*!
+                     * @brief Applies the last reverted step again.
+                     *
+                     * @return true if a step was applied, else false.
+                     */
+                    bool redo() noexcept(false);
+
+                    /*!
+                     * @brief The applied edits in order, as needed by replaySave.
+                     */
+                    const std::vector<FieldEdit>& edits() const noexcept;
+
+                    /*!
+                     * @brief Drops all steps, used after the save was replaced or written.
+                     */
+                    void clear() noexcept;
+
+                private:
+                    WillowTwoPlayerSaveGame* save_game;
+                    std::vector<FieldEdit> undo_stack;
+                    std::vector<FieldEdit> redo_stack;
+                };
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_EDIT_HPP
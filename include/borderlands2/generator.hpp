@@ -0,0 +1,65 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_GENERATOR_HPP
+#define BORDERLANDSSAVEEDITOR_GENERATOR_HPP
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for the synthetic save generator used by scale tests.
+             */
+            namespace Generator {
+
+                /*!
+                 * @brief Sizes of the repeated fields of a generated save.
+                 *
+                 * @details ChallengeList is a single message in WillowTwoPlayerSaveGame, the challenge
+                 *  progress is scaled through LevelChallengeUnlocks and OneOffLevelChallengeCompletion instead.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API GeneratorOptions {
+                    uint32_t seed = 1;
+                    uint32_t bank_slots = 0;
+                    uint32_t packed_weapons = 0;
+                    uint32_t packed_items = 0;
+                    uint32_t mission_playthroughs = 1;
+                    uint32_t missions_per_playthrough = 0;
+                    uint32_t challenges = 0;
+                };
+
+                /*!
+                 * @brief Fills a save with generated data.
+                 *
+                 * @details All required fields are set, so the result can be passed to encodeSave directly.
+                 *  The same options always produce the same save.
+                 *
+                 * @param[in] options The sizes of the generated repeated fields.
+                 * @param[out] save_game The message to fill. Existing contents are cleared.
+                 */
+                void BORDERLANDS2_SAVE_EDITOR_API generateSave(const GeneratorOptions &options, WillowTwoPlayerSaveGame *save_game) noexcept(false);
+
+                /*!
+                 * @brief Generates a save and writes it to a specific path with writeSave.
+                 *
+                 * @param[in] options The sizes of the generated repeated fields.
+                 * @param[in] path The path of the file to write.
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API generateSaveFile(const GeneratorOptions &options, const std::string &path) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_GENERATOR_HPP
@@ -0,0 +1,113 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_HISTORY_HPP
+#define BORDERLANDSSAVEEDITOR_HISTORY_HPP
+
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for keeping all versions of a save.
+             */
+            namespace History {
+
+                /*!
+                 * @brief Versions of one save stored as full bases and field level deltas in a single file.
+                 *
+                 * @details Every version is either stored as a base, the serialized save, or as a delta, the
+                 *  edits from the previous version built with Diff::diffEdits. A new base is written every
+                 *  rebase_interval versions and whenever the delta would not be smaller than the save, so
+                 *  reading any version parses one base and applies less than rebase_interval deltas.
+                 *
+                 *  The file is only ever appended to. A record that was not completely written is cut off
+                 *  again by append if the write failed, or when the store is opened after a crash.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API VersionStore {
+                public:
+                    /*!
+                     * @param path The file holding the versions, it is created by open if it does not exist.
+                     * @param rebase_interval The maximum number of versions between two bases.
+                     */
+                    explicit VersionStore(std::string path, size_t rebase_interval = 32) noexcept;
+
+                    ~VersionStore();
+
+                    /*!
+                     * @brief Creates the file or indexes the versions it holds.
+                     *
+                     * @return true on success, false if the file is no version store or can not be accessed.
+                     */
+                    bool open() noexcept(false);
+
+                    /*!
+                     * @brief Appends a new version.
+                     *
+                     * @return true on success, false if the store was not opened or the version could not be written.
+                     */
+                    bool append(const WillowTwoPlayerSaveGame &save_game) noexcept(false);
+
+                    /*!
+                     * @brief Reads a version.
+                     *
+                     * @param[in] version The version, starting at 0 for the first appended save.
+                     * @param[out] save_game The save of that version.
+                     * @return true on success, false if the version does not exist or is damaged.
+                     */
+                    bool read(size_t version, WillowTwoPlayerSaveGame *save_game) const noexcept(false);
+
+                    /*!
+                     * @brief The number of stored versions.
+                     */
+                    size_t size() const noexcept;
+
+                    /*!
+                     * @brief If a version is stored as a base.
+                     */
+                    bool isBase(size_t version) const noexcept;
+
+                private:
+                    /*!
+                     * @brief Location of a version in the file.
+                     */
+                    struct Record {
+                        bool base;
+                        uint64_t offset;
+                        uint32_t size;
+                    };
+
+                    bool readRecord(std::istream &stream, const Record &record, std::vector<uint8_t> *payload) const noexcept(false);
+
+                    std::string path;
+                    size_t rebase_interval;
+                    std::vector<Record> records;
+
+                    /*!
+                     * @brief If open succeeded, append refuses to write before so no file without header is created.
+                     */
+                    bool opened;
+
+                    /*!
+                     * @brief The last version, deltas of new versions are built against it.
+                     */
+                    std::unique_ptr<WillowTwoPlayerSaveGame> latest;
+                };
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_HISTORY_HPP
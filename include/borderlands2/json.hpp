@@ -0,0 +1,90 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_JSON_HPP
+#define BORDERLANDSSAVEEDITOR_JSON_HPP
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for the JSON representation of saves.
+             *
+             * @details A message is written as an object with the set fields under their proto names, repeated
+             *  fields as arrays. Enums are written by name, bytes as hex strings and floats that are not finite as
+             *  null. Every InventorySerialNumber is followed by an InventorySerial object holding the decoded
+             *  parts of the serial, if it can be decoded.
+             */
+            namespace Json {
+
+                /*!
+                 * @brief Streams a save as JSON into a file.
+                 *
+                 * @details The save is written with a rapidjson::Writer straight into the buffer of the file,
+                 *  without building a document.
+                 *
+                 * @param[in] save_game The save to export.
+                 * @param[in] file An open file to write to, it is not closed.
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API exportJson(const WillowTwoPlayerSaveGame &save_game,
+                                                             std::FILE *file) noexcept(false);
+
+                /*!
+                 * @brief Streams a save as JSON into a new file at path.
+                 *
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API exportJson(const WillowTwoPlayerSaveGame &save_game,
+                                                             const std::string &path) noexcept(false);
+
+                /*!
+                 * @brief Returns a save as JSON.
+                 */
+                std::string BORDERLANDS2_SAVE_EDITOR_API toJson(const WillowTwoPlayerSaveGame &save_game) noexcept(false);
+
+                /*!
+                 * @brief Reads a save from JSON in the format written by exportJson.
+                 *
+                 * @details The file is parsed with a rapidjson::Reader whose handler sets the fields of the save
+                 *  as they are read, without building a document. The messages created for the save are allocated
+                 *  on its arena, so a save created with google::protobuf::Arena::CreateMessage is filled without
+                 *  a heap allocation per message. Required fields are checked as soon as their object is closed.
+                 *  InventorySerial objects are skipped, the serial is read from InventorySerialNumber. Floats
+                 *  exported as null are read as NaN.
+                 *
+                 * @param[in] file An open file to read from, it is not closed.
+                 * @param[out] save_game The save to fill. Existing contents are cleared.
+                 * @return true if the file holds a complete save, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API importJson(std::FILE *file, WillowTwoPlayerSaveGame *save_game) noexcept(false);
+
+                /*!
+                 * @brief Reads a save from the JSON file at path.
+                 *
+                 * @return true if the file holds a complete save, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API importJson(const std::string &path, WillowTwoPlayerSaveGame *save_game) noexcept(false);
+
+                /*!
+                 * @brief Reads a save from a JSON string.
+                 *
+                 * @return true if the string holds a complete save, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API fromJson(const std::string &json, WillowTwoPlayerSaveGame *save_game) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_JSON_HPP
@@ -0,0 +1,152 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_MISSIONS_HPP
+#define BORDERLANDSSAVEEDITOR_MISSIONS_HPP
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <boost/dynamic_bitset.hpp>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for the mission progress of saves as bitsets.
+             */
+            namespace Missions {
+
+                /*!
+                 * @brief A set of missions, bit i is the mission at position i of the MissionNames it was built with.
+                 */
+                using MissionSet = boost::dynamic_bitset<uint64_t>;
+
+                /*!
+                 * @brief The number of values of MissionStatus.
+                 */
+                constexpr int status_count = 6;
+
+                /*!
+                 * @brief Interns mission names to dense bit positions.
+                 *
+                 * @details Indices sharing one MissionNames use the same position for a mission, so their sets
+                 *  can be combined. Names are never removed. Not thread safe.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API MissionNames {
+                public:
+                    /*!
+                     * @brief Returns the position of a name, adding it if it is new.
+                     */
+                    size_t intern(const std::string &name) noexcept(false);
+
+                    /*!
+                     * @brief Looks up the position of a name.
+                     *
+                     * @return true if the name is known, else false.
+                     */
+                    bool find(const std::string &name, size_t *position) const noexcept(false);
+
+                    /*!
+                     * @brief Returns the name at a position.
+                     */
+                    const std::string &name(size_t position) const noexcept(false);
+
+                    /*!
+                     * @brief Returns the number of names, the size of the sets built with them.
+                     */
+                    size_t size() const noexcept(false);
+
+                private:
+                    std::unordered_map<std::string, size_t> positions;
+                    std::vector<std::string> names;
+                };
+
+                /*!
+                 * @brief The missions of one save as one set per playthrough and status.
+                 *
+                 * @details Building the index compares every mission name once. Afterwards checking the progress
+                 *  of a playthrough and comparing saves indexed with the same names are word wise operations on
+                 *  the sets.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API MissionIndex {
+                public:
+                    /*!
+                     * @brief Creates an empty index.
+                     *
+                     * @param[in] names The names to intern the missions in, shared with other indices to compare
+                     *  their sets.
+                     */
+                    explicit MissionIndex(std::shared_ptr<MissionNames> names = std::make_shared<MissionNames>()) noexcept(false);
+
+                    /*!
+                     * @brief Indexes the missions of a save, replacing the previous contents.
+                     *
+                     * @details Playthroughs are indexed by their PlayThroughNumber, or by their position if it is
+                     *  not set, negative or not less than the number of playthroughs. If a mission occurs more than
+                     *  once in a playthrough the last status wins.
+                     */
+                    void build(const WillowTwoPlayerSaveGame &save_game) noexcept(false);
+
+                    /*!
+                     * @brief Returns one more than the highest indexed playthrough number.
+                     */
+                    size_t playthroughCount() const noexcept(false);
+
+                    /*!
+                     * @brief Returns the missions of a playthrough with a status.
+                     *
+                     * @param[in] playthrough The playthrough number.
+                     * @param[in] status A MissionStatus value.
+                     * @return The set, sized to the current number of names. Empty if the playthrough or status
+                     *  does not exist.
+                     */
+                    MissionSet missions(size_t playthrough, int status) const noexcept(false);
+
+                    /*!
+                     * @brief Returns all missions of a playthrough, whatever their status.
+                     */
+                    MissionSet known(size_t playthrough) const noexcept(false);
+
+                    /*!
+                     * @brief Returns the status of a mission in a playthrough.
+                     *
+                     * @return The MissionStatus value, -1 if the mission is not part of the playthrough.
+                     */
+                    int status(size_t playthrough, const std::string &mission) const noexcept(false);
+
+                    /*!
+                     * @brief Returns the names of the missions in a set.
+                     */
+                    std::vector<std::string> missionNames(const MissionSet &set) const noexcept(false);
+
+                    /*!
+                     * @brief Returns the names the missions are interned in.
+                     */
+                    const std::shared_ptr<MissionNames> &names() const noexcept(false);
+
+                private:
+                    /*!
+                     * @brief Returns a set resized to the current number of names.
+                     */
+                    MissionSet resized(MissionSet set) const noexcept(false);
+
+                    std::shared_ptr<MissionNames> mission_names;
+                    std::vector<std::array<MissionSet, status_count>> playthroughs;
+                };
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_MISSIONS_HPP
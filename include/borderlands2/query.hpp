@@ -0,0 +1,144 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_QUERY_HPP
+#define BORDERLANDSSAVEEDITOR_QUERY_HPP
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for queries over many saves.
+             *
+             * @details Fields are named by their proto names. Top level fields of the save are named directly,
+             *  e.g. ExpLevel. Fields of repeated messages are prefixed with the message field, e.g.
+             *  PackedWeaponData.QuickSlot or SkillData.Grade. MissionData names the missions of all playthroughs.
+             *
+             *  Saves store weapons and items only as serials in PackedWeaponData and PackedItemData, WeaponData
+             *  and ItemData are empty. The balance and manufacturer of a serial are asset indices that need the
+             *  asset libraries of the game to be named, so they can not be queried.
+             */
+            namespace Query {
+
+                /*!
+                 * @brief How the value of a field is compared to the value of a condition.
+                 *
+                 * @details Numbers are compared numerically, strings and enum names lexicographically. contains
+                 *  checks if a string or enum name contains the value.
+                 */
+                enum BORDERLANDS2_SAVE_EDITOR_API Comparison {
+                    equal,
+                    not_equal,
+                    less,
+                    less_equal,
+                    greater,
+                    greater_equal,
+                    contains
+                };
+
+                /*!
+                 * @brief A condition on one field.
+                 *
+                 * @details Conditions on top level fields have to hold for a save to match. The conditions on the
+                 *  fields of a repeated message form a group: a save matches if one of its elements passes all
+                 *  conditions of the group. Negated conditions form a second group per message, a save matches
+                 *  if none of its elements passes all of them.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API Condition {
+                    std::string field;
+                    Comparison comparison = Comparison::equal;
+                    std::string value;
+                    bool negated = false;
+                };
+
+                /*!
+                 * @brief A query over saves.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API SaveQuery {
+                    std::vector<Condition> conditions;
+
+                    /*!
+                     * @brief Field the matches are counted by, empty to only list the matching saves.
+                     *
+                     * @details A top level field counts the matching saves per value. A field of a repeated
+                     *  message counts the elements of the matching saves per value, restricted to the elements
+                     *  passing the not negated conditions on that message.
+                     */
+                    std::string count_by;
+                };
+
+                /*!
+                 * @brief The result of a query.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API QueryResult {
+                    /*!
+                     * @brief The paths of the matching saves, in the order they were given.
+                     */
+                    std::vector<std::string> matches;
+
+                    /*!
+                     * @brief The counts per value of count_by.
+                     */
+                    std::map<std::string, uint64_t> counts;
+
+                    /*!
+                     * @brief The number of saves that had to be parsed completely.
+                     */
+                    size_t parsed = 0;
+
+                    /*!
+                     * @brief The number of saves that could not be read.
+                     */
+                    size_t failed = 0;
+                };
+
+                /*!
+                 * @brief Builds a query from command line terms.
+                 *
+                 * @details Every term is either a condition <field><op><value> with op one of =, !=, <, <=, >, >=
+                 *  and ~ for contains, prefixed with ! to negate it, or count:<field>. For example ExpLevel>=72
+                 *  PlayerClass~Siren !MissionData.Mission=GD_Episode01.M_Ep1_Champion !MissionData.Status=Complete
+                 *  finds the level 72 Sirens that have not completed M_Ep1_Champion. Mission names are fully
+                 *  qualified, a name that matches no mission makes the negated group match every save.
+                 *
+                 * @param[in] terms The terms of the query.
+                 * @param[out] query The parsed query.
+                 * @return true on success, false if a term is malformed or names an unknown field.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API parseQuery(const std::vector<std::string> &terms,
+                                                             SaveQuery *query) noexcept(false);
+
+                /*!
+                 * @brief Runs a query over saves.
+                 *
+                 * @details The saves are decoded on worker threads. The conditions on top level fields are checked
+                 *  on the decoded payload by scanning its top level tags, so a save is only parsed completely if
+                 *  it passes them and the query needs a repeated message. A query that only uses top level fields
+                 *  never parses a save.
+                 *
+                 * @param[in] paths The save files to query.
+                 * @param[in] query The query to run.
+                 * @param[out] result The matches and counts.
+                 * @param[in] threads The number of worker threads, 0 uses one per hardware thread.
+                 * @return true on success, false if the query names an unknown field or a value of the wrong type.
+                 *  Saves that can not be read are counted in result and do not fail the query.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API runQuery(const std::vector<std::string> &paths,
+                                                           const SaveQuery &query, QueryResult *result,
+                                                           unsigned int threads = 0) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_QUERY_HPP
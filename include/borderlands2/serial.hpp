@@ -0,0 +1,79 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_SERIAL_HPP
+#define BORDERLANDSSAVEEDITOR_SERIAL_HPP
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for the inventory serial numbers of weapons and items.
+             *
+             * @details A serial starts with a version byte, the high bit of it marks weapons. It is followed by a
+             *  big endian seed. The remaining bytes are scrambled with the seed, the first two of them hold a
+             *  checksum over the whole serial and the rest is the bit packed list of asset indices.
+             */
+            namespace Serial {
+
+                /*!
+                 * @brief The serial version used by Borderlands 2.
+                 */
+                constexpr uint8_t serial_version = 7;
+
+                /*!
+                 * @brief Length of the serial every checksum is calculated over.
+                 */
+                constexpr size_t serial_length = 40;
+
+                /*!
+                 * @brief The header of a serial plus its descrambled asset data.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API DecodedSerial {
+                    bool is_weapon = false;
+                    uint8_t version = serial_version;
+                    uint32_t seed = 0;
+                    uint16_t checksum = 0;
+
+                    /*!
+                     * @brief The first byte of the asset data, 0 for the base game asset set.
+                     */
+                    uint8_t asset_library_set_id = 0;
+
+                    /*!
+                     * @brief The descrambled bytes following the checksum, starting with the asset library set id.
+                     */
+                    std::vector<uint8_t> asset_data;
+                };
+
+                /*!
+                 * @brief Descrambles a serial and verifies its checksum.
+                 *
+                 * @param[in] serial The serial as stored in the save.
+                 * @param[out] decoded The decoded serial.
+                 * @return true if the serial has a known version and a valid checksum, else false.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API decodeSerial(const std::string& serial, DecodedSerial* decoded) noexcept(false);
+
+                /*!
+                 * @brief Scrambles a serial, the checksum is calculated and replaces decoded.checksum.
+                 *
+                 * @param[in] decoded The serial to encode.
+                 * @return The serial as stored in the save.
+                 */
+                std::string BORDERLANDS2_SAVE_EDITOR_API encodeSerial(const DecodedSerial& decoded) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_SERIAL_HPP
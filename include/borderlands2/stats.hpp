@@ -0,0 +1,110 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_STATS_HPP
+#define BORDERLANDSSAVEEDITOR_STATS_HPP
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for the StatsData blob of a save.
+             *
+             * @details The blob starts with a little endian uint32 version and the uint32 size of the rest of the
+             *  blob, followed by a uint16 entry count and the entries. Every entry is a uint16 stat id, a type
+             *  byte, an int32 value and five bytes that are kept as they are. Only the int32 type 1 is known, a
+             *  blob with another type is rejected. All numbers are little endian.
+             */
+            namespace Stats {
+
+                /*!
+                 * @brief Random access to the stats in a StatsData blob.
+                 *
+                 * @details Nothing is decoded when the view is created. The first access scans the entry headers
+                 *  once and keeps the offset of every stat, lookups then read only the requested value. The blob
+                 *  has to outlive the view and must not be changed other than through set, the offsets would
+                 *  become stale.
+                 */
+                class BORDERLANDS2_SAVE_EDITOR_API StatsView {
+                public:
+                    /*!
+                     * @brief Creates a read only view, set always fails.
+                     */
+                    explicit StatsView(const std::string &blob) noexcept;
+
+                    /*!
+                     * @brief Creates a view that can patch the blob, e.g. on WillowTwoPlayerSaveGame::mutable_statsdata.
+                     */
+                    explicit StatsView(std::string *blob) noexcept;
+
+                    /*!
+                     * @brief Checks if the blob is a well formed StatsData blob.
+                     */
+                    bool valid() const noexcept(false);
+
+                    /*!
+                     * @brief Returns the number of stats, 0 if the blob is malformed.
+                     */
+                    size_t size() const noexcept(false);
+
+                    /*!
+                     * @brief Returns the ids of all stats, in the order of the blob.
+                     */
+                    std::vector<uint16_t> ids() const noexcept(false);
+
+                    /*!
+                     * @brief Reads a stat.
+                     *
+                     * @param[in] id The id of the stat.
+                     * @param[out] value The value of the stat.
+                     * @return true if the stat exists, else false.
+                     */
+                    bool get(uint16_t id, int32_t *value) const noexcept(false);
+
+                    /*!
+                     * @brief Overwrites the value of a stat in place.
+                     *
+                     * @details Only the four bytes of the value change, the size of the blob and the offsets of
+                     *  the other stats stay the same.
+                     *
+                     * @return true if the stat exists and the view is writable, else false.
+                     */
+                    bool set(uint16_t id, int32_t value) noexcept(false);
+
+                private:
+                    /*!
+                     * @brief Builds the offset index on the first access.
+                     *
+                     * @return true if the blob is well formed.
+                     */
+                    bool index() const noexcept(false);
+
+                    const std::string *blob;
+                    std::string *writable_blob;
+
+                    mutable bool indexed;
+                    mutable bool well_formed;
+
+                    /*!
+                     * @brief Offset of the value of every stat by id.
+                     */
+                    mutable std::unordered_map<uint16_t, size_t> value_offsets;
+
+                    mutable std::vector<uint16_t> stat_ids;
+                };
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_STATS_HPP
@@ -0,0 +1,96 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_WIRE_FORMAT_HPP
+#define BORDERLANDSSAVEEDITOR_WIRE_FORMAT_HPP
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "borderlands2/bl2_save_editor_exports.hpp"
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace Borderlands2 {
+
+            /*!
+             * @brief Namespace for working on the serialized save payload without parsing it.
+             */
+            namespace WireFormat {
+
+                /*!
+                 * @brief The protobuf wire types, groups are not used by the save messages.
+                 */
+                enum BORDERLANDS2_SAVE_EDITOR_API WireType {
+                    varint = 0,
+                    fixed64 = 1,
+                    length_delimited = 2,
+                    start_group = 3,
+                    end_group = 4,
+                    fixed32 = 5
+                };
+
+                /*!
+                 * @brief Location of one field in a serialized message.
+                 */
+                struct BORDERLANDS2_SAVE_EDITOR_API FieldSpan {
+                    uint32_t number;
+                    WireType wire_type;
+
+                    /*!
+                     * @brief Index of the span of the enclosing message field, -1 for top level fields.
+                     */
+                    int32_t parent;
+
+                    /*!
+                     * @brief Offset of the tag.
+                     */
+                    size_t offset;
+
+                    /*!
+                     * @brief Offset of the value, behind the tag and the length of length delimited fields.
+                     */
+                    size_t value_offset;
+
+                    /*!
+                     * @brief Offset behind the value.
+                     */
+                    size_t end;
+                };
+
+                /*!
+                 * @brief Indexes the fields of a serialized WillowTwoPlayerSaveGame.
+                 *
+                 * @details Fields declared as messages are indexed recursively. The spans are stored in the order
+                 *  of their tags, so a parent always precedes its children and the offsets are ascending.
+                 *
+                 * @param[in] data The serialized message.
+                 * @param[in] size The size of the serialized message.
+                 * @param[out] index The spans of all fields, existing contents are cleared.
+                 * @return true on success, false if the data is not a well formed message.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API indexSaveFields(const uint8_t* data, size_t size,
+                                                                  std::vector<FieldSpan>* index) noexcept(false);
+
+                /*!
+                 * @brief Indexes only the top level fields of a serialized WillowTwoPlayerSaveGame.
+                 *
+                 * @details Message fields are skipped over by their length, so this is a single pass over the
+                 *  tags of the save without looking into nested messages.
+                 *
+                 * @param[in] data The serialized message.
+                 * @param[in] size The size of the serialized message.
+                 * @param[out] index The spans of the top level fields, existing contents are cleared.
+                 * @return true on success, false if the data is not a well formed message.
+                 */
+                bool BORDERLANDS2_SAVE_EDITOR_API indexTopLevelFields(const uint8_t* data, size_t size,
+                                                                      std::vector<FieldSpan>* index) noexcept(false);
+            }
+        }
+    }
+}
+
+#endif //BORDERLANDSSAVEEDITOR_WIRE_FORMAT_HPP
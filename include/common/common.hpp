@@ -1,7 +1,16 @@
 
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 #include <rapidjson/document.h>
 
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
 #include "common/bl_common_exports.hpp"
 
 namespace D4v3 {
@@ -20,7 +29,58 @@ namespace D4v3 {
              */
             namespace Huffman {
 
-                bool BORDERLANDS_COMMON_API decode(const char* input_array, uint32_t input_size, char* output_array, int32_t output_size) noexcept(false);
+                /*!
+                 * @brief Decodes a byte array written by encode.
+                 *
+                 * @details Corrupt input is rejected: the tree may have at most 511 nodes and neither the tree nor
+                 *  the codes may run past the end of the input. The bounds are checked whenever the internal 64 bit
+                 *  buffer is refilled, not for every bit. The tree is rebuilt into a flat array together with a
+                 *  table that decodes the first 10 bits of a code with one lookup.
+                 *
+                 * @param[in] input_array The encoded bytes.
+                 * @param[in] input_size The number of bytes in input_array.
+                 * @param[out] output_array The array the decoded bytes are stored in.
+                 * @param[in] output_size The number of bytes to decode.
+                 * @param[out] error_offset If not null and decoding fails, the number of bits of input_array read
+                 *  before the failure: up to the flag of the 256th branch node, as such a tree would have more than 511
+                 *  nodes, or the input size for truncated input.
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS_COMMON_API decode(const char* input_array, uint32_t input_size, char* output_array, int32_t output_size,
+                                                   uint64_t* error_offset = nullptr) noexcept(false);
+
+                /*!
+                 * @brief Huffman encodes a byte array in the format read by decode.
+                 *
+                 * @details The serialized tree is written first (0 bit for a branch followed by both children,
+                 *  1 bit followed by the 8 bit symbol for a leaf), then the code of every input byte. Bits are
+                 *  packed most significant bit first, the last byte is padded with zero bits.
+                 *
+                 * @param[in] input_array The bytes to encode.
+                 * @param[in] input_size The number of bytes in input_array.
+                 * @param[out] output_array The vector the encoded bytes are appended to.
+                 * @return true on success, else false.
+                 */
+                bool BORDERLANDS_COMMON_API encode(const char* input_array, uint32_t input_size, std::vector<uint8_t>* output_array) noexcept(false);
+            }
+
+            /*!
+             * @brief Namespace for checksum functions.
+             */
+            namespace Checksum {
+
+                /*!
+                 * @brief Computes the CRC32 (ISO-HDLC, as used by zlib) of a byte array.
+                 *
+                 * @details Uses a slicing-by-8 table kernel that processes 8 input bytes per step. Passing the
+                 *  result of a previous call as crc continues the checksum over concatenated data.
+                 *
+                 * @param[in] data The bytes to compute the checksum of.
+                 * @param[in] size The number of bytes in data.
+                 * @param[in] crc The checksum of the preceding data, 0 for the first block.
+                 * @return The checksum of all data passed so far.
+                 */
+                uint32_t BORDERLANDS_COMMON_API crc32(const uint8_t* data, size_t size, uint32_t crc = 0) noexcept;
             }
 
             namespace Streams {
@@ -30,9 +90,283 @@ namespace D4v3 {
                      little_endian
                 };
 
-                void BORDERLANDS_COMMON_API read_uint32(std::istream* stream, uint32_t* num, D4v3::Borderlands::Common::Streams::Endian endianess) noexcept(false);
+                /*!
+                 * @brief The byte order of the platform the library is compiled for.
+                 */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                constexpr Endian native_endian = big_endian;
+#else
+                constexpr Endian native_endian = little_endian;
+#endif
+
+                inline uint8_t byte_swap(uint8_t num) noexcept {
+                    return num;
+                }
+
+                inline uint16_t byte_swap(uint16_t num) noexcept {
+#if defined(_MSC_VER)
+                    return _byteswap_ushort(num);
+#else
+                    return __builtin_bswap16(num);
+#endif
+                }
+
+                inline uint32_t byte_swap(uint32_t num) noexcept {
+#if defined(_MSC_VER)
+                    return _byteswap_ulong(num);
+#else
+                    return __builtin_bswap32(num);
+#endif
+                }
+
+                inline uint64_t byte_swap(uint64_t num) noexcept {
+#if defined(_MSC_VER)
+                    return _byteswap_uint64(num);
+#else
+                    return __builtin_bswap64(num);
+#endif
+                }
+
+                /*!
+                 * @brief Converts a number between native byte order and the given byte order.
+                 *
+                 * @details The byte order is a template parameter, so the conversion compiles to either nothing
+                 *  or a single byte swap instruction.
+                 */
+                template<Endian E, typename T>
+                inline T convert_endian(T num) noexcept {
+                    static_assert(std::is_integral<T>::value, "Only integral types can be converted!");
+                    using unsigned_type = typename std::make_unsigned<T>::type;
+                    return E == native_endian ? num : static_cast<T>(byte_swap(static_cast<unsigned_type>(num)));
+                }
+
+                /*!
+                 * @brief Throws the std::out_of_range exception for a access of count bytes at offset.
+                 *
+                 * @details Kept out of line so the bounds checks of the inline readers stay small.
+                 */
+                [[noreturn]] void BORDERLANDS_COMMON_API throw_out_of_range(size_t count, size_t offset, size_t size) noexcept(false);
+
+                /*!
+                 * @brief Bounds checked read cursor over a byte array.
+                 *
+                 * @details The reader does not own or copy the data, the array has to outlive the reader.
+                 *  Every read checks the remaining size once and throws std::out_of_range if the array is too
+                 *  short, the cursor is not moved in that case.
+                 */
+                class ByteReader {
+                public:
+                    ByteReader(const uint8_t* data, size_t size) noexcept : data(data), size(size), offset(0) {}
+
+                    ByteReader(const char* data, size_t size) noexcept
+                            : ByteReader(reinterpret_cast<const uint8_t*>(data), size) {}
+
+                    /*!
+                     * @brief Reads a number in the byte order given as template parameter.
+                     *
+                     * @throw std::out_of_range If less than sizeof(T) bytes are remaining.
+                     */
+                    template<typename T, Endian E>
+                    T read() noexcept(false) {
+                        static_assert(std::is_integral<T>::value, "Only integral types can be read!");
+                        require(sizeof(T));
+                        T num;
+                        std::memcpy(&num, data + offset, sizeof(T));
+                        offset += sizeof(T);
+                        return convert_endian<E>(num);
+                    }
+
+                    /*!
+                     * @brief Reads a number in a byte order only known at runtime.
+                     *
+                     * @throw std::out_of_range If less than sizeof(T) bytes are remaining.
+                     */
+                    template<typename T>
+                    T read(Endian endianess) noexcept(false) {
+                        return endianess == big_endian ? read<T, big_endian>() : read<T, little_endian>();
+                    }
+
+                    /*!
+                     * @brief Returns a pointer to the next count bytes and moves the cursor behind them.
+                     *
+                     * @throw std::out_of_range If less than count bytes are remaining.
+                     */
+                    const uint8_t* read_bytes(size_t count) noexcept(false) {
+                        require(count);
+                        const uint8_t* bytes = data + offset;
+                        offset += count;
+                        return bytes;
+                    }
+
+                    /*!
+                     * @brief Reads a base 128 varint as used by the protobuf wire format.
+                     *
+                     * @throw std::out_of_range If the data ends inside the varint.
+                     * @throw std::invalid_argument If the varint is longer than 10 bytes.
+                     */
+                    uint64_t read_varint() noexcept(false) {
+                        uint64_t value = 0;
+                        for (unsigned int shift = 0; shift < 64; shift += 7) {
+                            require(1);
+                            uint8_t byte = data[offset++];
+                            value |= (uint64_t) (byte & 0x7Fu) << shift;
+                            if ((byte & 0x80u) == 0) {
+                                return value;
+                            }
+                        }
+                        throw std::invalid_argument("Varint is longer than 10 bytes!");
+                    }
 
-                void BORDERLANDS_COMMON_API read_int32(std::istream* stream, int32_t* num, D4v3::Borderlands::Common::Streams::Endian endianess) noexcept(false);
+                    /*!
+                     * @brief Moves the cursor count bytes forward.
+                     *
+                     * @throw std::out_of_range If less than count bytes are remaining.
+                     */
+                    void skip(size_t count) noexcept(false) {
+                        require(count);
+                        offset += count;
+                    }
+
+                    size_t position() const noexcept {
+                        return offset;
+                    }
+
+                    size_t remaining() const noexcept {
+                        return size - offset;
+                    }
+
+                private:
+                    void require(size_t count) const noexcept(false) {
+                        if (count > size - offset) {
+                            throw_out_of_range(count, offset, size);
+                        }
+                    }
+
+                    const uint8_t* data;
+                    size_t size;
+                    size_t offset;
+                };
+
+                /*!
+                 * @brief Append only writer into a byte vector with the same byte order model as ByteReader.
+                 *
+                 * @details Space can be reserved for values that are only known after later data was written,
+                 *  like sizes and checksums, and patched afterwards. The writer does not own the vector, it has
+                 *  to outlive the writer. Existing contents of the vector are kept and offsets are relative to
+                 *  the start of the vector.
+                 */
+                class ByteWriter {
+                public:
+                    explicit ByteWriter(std::vector<uint8_t>* buffer) noexcept : buffer(buffer) {}
+
+                    /*!
+                     * @brief Appends a number in the byte order given as template parameter.
+                     */
+                    template<typename T, Endian E>
+                    void write(T num) noexcept(false) {
+                        static_assert(std::is_integral<T>::value, "Only integral types can be written!");
+                        num = convert_endian<E>(num);
+                        size_t offset = buffer->size();
+                        buffer->resize(offset + sizeof(T));
+                        std::memcpy(buffer->data() + offset, &num, sizeof(T));
+                    }
+
+                    /*!
+                     * @brief Appends a number in a byte order only known at runtime.
+                     */
+                    template<typename T>
+                    void write(T num, Endian endianess) noexcept(false) {
+                        if (endianess == big_endian) {
+                            write<T, big_endian>(num);
+                        } else {
+                            write<T, little_endian>(num);
+                        }
+                    }
+
+                    /*!
+                     * @brief Appends a base 128 varint as read by ByteReader::read_varint.
+                     */
+                    void write_varint(uint64_t num) noexcept(false) {
+                        while (num >= 0x80u) {
+                            buffer->push_back((uint8_t) (num | 0x80u));
+                            num >>= 7;
+                        }
+                        buffer->push_back((uint8_t) num);
+                    }
+
+                    /*!
+                     * @brief Appends count bytes from data.
+                     */
+                    void write_bytes(const void* data, size_t count) noexcept(false) {
+                        const auto* bytes = static_cast<const uint8_t*>(data);
+                        buffer->insert(buffer->end(), bytes, bytes + count);
+                    }
+
+                    /*!
+                     * @brief Appends count zero bytes to be filled later.
+                     *
+                     * @return The offset of the first reserved byte.
+                     */
+                    size_t reserve(size_t count) noexcept(false) {
+                        size_t offset = buffer->size();
+                        buffer->resize(offset + count);
+                        return offset;
+                    }
+
+                    /*!
+                     * @brief Reserves space for a number of type T to be written later with patch.
+                     *
+                     * @return The offset of the reserved number.
+                     */
+                    template<typename T>
+                    size_t reserve() noexcept(false) {
+                        return reserve(sizeof(T));
+                    }
+
+                    /*!
+                     * @brief Overwrites the number at offset in the byte order given as template parameter.
+                     *
+                     * @throw std::out_of_range If the number does not fit into the written data at offset.
+                     */
+                    template<typename T, Endian E>
+                    void patch(size_t offset, T num) noexcept(false) {
+                        static_assert(std::is_integral<T>::value, "Only integral types can be written!");
+                        uint8_t* target = at(offset, sizeof(T));
+                        num = convert_endian<E>(num);
+                        std::memcpy(target, &num, sizeof(T));
+                    }
+
+                    /*!
+                     * @brief Returns a pointer to count already written or reserved bytes at offset.
+                     *
+                     * @details The pointer is invalidated by the next write or reserve.
+                     *
+                     * @throw std::out_of_range If the range is not part of the written data.
+                     */
+                    uint8_t* at(size_t offset, size_t count) noexcept(false) {
+                        if (offset > buffer->size() || count > buffer->size() - offset) {
+                            throw_out_of_range(count, offset, buffer->size());
+                        }
+                        return buffer->data() + offset;
+                    }
+
+                    /*!
+                     * @brief Drops all data behind size, used to give back unused reserved space.
+                     *
+                     * @throw std::out_of_range If size is behind the written data.
+                     */
+                    void truncate(size_t size) noexcept(false) {
+                        at(size, 0);
+                        buffer->resize(size);
+                    }
+
+                    size_t position() const noexcept {
+                        return buffer->size();
+                    }
+
+                private:
+                    std::vector<uint8_t>* buffer;
+                };
             }
         }
     }
@@ -0,0 +1,81 @@
+/*!
+ * @brief This file defines the hex viewer of the raw tab.
+ *
+ * @author David Oberacker
+ *
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QAbstractScrollArea>
+#include <QString>
+
+#include <borderlands2/wire_format.hpp>
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace SaveEditor {
+
+            /*!
+             * @brief Hex and ASCII view over a byte buffer with protobuf field highlighting.
+             *
+             * @details The view keeps a reference to the buffer and paints only the lines inside the viewport,
+             *  nothing is copied or converted to text up front. Bytes are colored by the innermost field of the
+             *  field index containing them, tags and lengths are colored separately. Hovering a byte shows the
+             *  path of its field.
+             */
+            class HexView : public QAbstractScrollArea {
+                Q_OBJECT
+
+            public:
+                explicit HexView(QWidget* parent = nullptr);
+
+                /*!
+                 * @brief Shows another buffer.
+                 *
+                 * @param data The bytes to show, may be nullptr.
+                 * @param fields The field index of data, may be nullptr to show the bytes without highlighting.
+                 */
+                void setData(std::shared_ptr<const std::vector<uint8_t>> data,
+                             std::shared_ptr<const std::vector<Borderlands2::WireFormat::FieldSpan>> fields);
+
+            protected:
+                void paintEvent(QPaintEvent* event) override;
+
+                void resizeEvent(QResizeEvent* event) override;
+
+                bool viewportEvent(QEvent* event) override;
+
+            private:
+                void updateScrollBars();
+
+                size_t lineCount() const;
+
+                /*!
+                 * @brief Returns the offset of the byte at a viewport position, or -1 if there is none.
+                 */
+                int64_t offsetAt(const QPoint& position) const;
+
+                /*!
+                 * @brief Returns the index of the innermost field containing offset, or -1 if there is none.
+                 */
+                int32_t fieldAt(size_t offset) const;
+
+                /*!
+                 * @brief Returns the dotted field names from the top level message down to a field.
+                 */
+                QString fieldPath(int32_t field) const;
+
+                std::shared_ptr<const std::vector<uint8_t>> data;
+                std::shared_ptr<const std::vector<Borderlands2::WireFormat::FieldSpan>> fields;
+
+                int line_height;
+                int char_width;
+            };
+        }
+    }
+}
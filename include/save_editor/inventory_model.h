@@ -0,0 +1,87 @@
+/*!
+ * @brief This file defines the table model for the backpack and bank tabs.
+ *
+ * @author David Oberacker
+ *
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QAbstractTableModel>
+
+#include <borderlands2/serial.hpp>
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace SaveEditor {
+
+            /*!
+             * @brief Table model over the weapons and items of a save.
+             *
+             * @details The model reads the repeated fields of the save directly and creates no per row objects up
+             *  front. Serials are decoded on the first request for one of their columns, which the view only makes
+             *  for visible rows, and cached until another save is set.
+             */
+            class InventoryTableModel : public QAbstractTableModel {
+                Q_OBJECT
+
+            public:
+                /*!
+                 * @brief The repeated fields a model shows.
+                 */
+                enum Source {
+                    backpack,   //!< PackedWeaponData followed by PackedItemData.
+                    bank        //!< BankSlots.
+                };
+
+                enum Column {
+                    type_column,
+                    set_column,
+                    seed_column,
+                    quantity_column,
+                    slot_column,
+                    mark_column,
+                    serial_column,
+                    column_count
+                };
+
+                explicit InventoryTableModel(Source source, QObject* parent = nullptr);
+
+                /*!
+                 * @brief Shows another save, the decoded serials of the previous save are dropped.
+                 */
+                void setSaveGame(std::shared_ptr<const WillowTwoPlayerSaveGame> save_game);
+
+                int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+                int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+                QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+                QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+            private:
+                const std::string& serialAt(int row) const;
+
+                /*!
+                 * @brief Returns the decoded serial of a row, or nullptr if the serial is invalid.
+                 */
+                const Borderlands2::Serial::DecodedSerial* decodedAt(int row) const;
+
+                QVariant displayData(int row, int column) const;
+
+                Source source;
+                std::shared_ptr<const WillowTwoPlayerSaveGame> save_game;
+
+                mutable std::vector<std::unique_ptr<Borderlands2::Serial::DecodedSerial>> decoded;
+                mutable std::vector<bool> decode_attempted;
+            };
+        }
+    }
+}
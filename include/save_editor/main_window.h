@@ -0,0 +1,151 @@
+/*!
+ * @brief This file defines the main window of the application.
+ *
+ * @author David Oberacker
+ *
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <QHash>
+#include <QLabel>
+#include <QMainWindow>
+#include <QProgressBar>
+#include <QSet>
+#include <QString>
+#include <QTableView>
+
+#include <borderlands2/edit.hpp>
+
+#include "save_editor/hex_view.h"
+#include "save_editor/inventory_model.h"
+#include "save_editor/save_loader.h"
+
+class WillowTwoPlayerSaveGame;
+
+namespace Ui {
+    class MainWindow;
+}
+
+namespace D4v3 {
+    namespace Borderlands {
+        namespace SaveEditor {
+
+            /*!
+             * @brief The main window showing the currently opened save.
+             *
+             * @details Saves are loaded with a SaveLoader, so the window stays responsive while a save is
+             *  decoded. The shown save is replaced in one step on the GUI thread once loading finished, a failed
+             *  load keeps the previous save.
+             *
+             *  Tab contents are built from the save when a tab is shown for the first time after a load, so
+             *  opening a save only builds the current tab.
+             *
+             *  Edits are recorded in an EditHistory, the amounts on the currency tab are editable so far. Saving
+             *  replays them onto the file the save was loaded from. The raw tab keeps showing the payload as
+             *  loaded.
+             */
+            class MainWindow : public QMainWindow {
+                Q_OBJECT
+
+            public:
+                explicit MainWindow(QWidget* parent = nullptr);
+
+                ~MainWindow() override;
+
+                /*!
+                 * @brief Starts loading the save at path.
+                 */
+                void openSave(const QString& path);
+
+            private slots:
+                void onOpenTriggered();
+
+                void onLoadStageChanged(int stage);
+
+                void onSaveLoaded(const LoadedSave& save, const QString& path);
+
+                void onLoadFailed(const QString& path);
+
+                void onCurrentTabChanged(int index);
+
+                void onUndoTriggered();
+
+                void onRedoTriggered();
+
+                void onSaveTriggered();
+
+                void onSaveAsTriggered();
+
+            private:
+                /*!
+                 * @brief Rebuilds the current tab and marks all other tabs for rebuilding after the save changed.
+                 */
+                void refreshTabs();
+
+                void updateEditActions();
+
+                /*!
+                 * @brief Writes the save with all edits to path.
+                 *
+                 * @return true on success, else false.
+                 */
+                bool saveTo(const QString& path);
+
+                /*!
+                 * @brief Builds the contents of the tab at index if it was not built for the shown save yet.
+                 */
+                void populateTab(int index);
+
+                /*!
+                 * @brief Replaces the contents of a tab built for a previous save.
+                 */
+                void setTabContent(QWidget* tab, QWidget* content);
+
+                QWidget* createGeneralContent() const;
+
+                QWidget* createCharacterContent() const;
+
+                /*!
+                 * @brief Builds the currency tab, changing an amount records an edit.
+                 */
+                QWidget* createCurrencyContent();
+
+                /*!
+                 * @brief Sets an entry of CurrencyOnHand through the history, unchanged amounts are not recorded.
+                 */
+                void setCurrency(int index, int32_t amount);
+
+                QWidget* createFastTravelContent() const;
+
+                /*!
+                 * @brief Adds a table view showing model to an empty tab.
+                 */
+                QTableView* createInventoryView(QWidget* tab, InventoryTableModel* model);
+
+                Ui::MainWindow* ui;
+                SaveLoader loader;
+                QLabel* load_stage_label;
+                QProgressBar* load_progress;
+
+                InventoryTableModel backpack_model;
+                InventoryTableModel bank_model;
+                QTableView* backpack_view;
+                QTableView* bank_view;
+                HexView* raw_view;
+
+                QSet<QWidget*> populated_tabs;
+                QHash<QWidget*, QWidget*> tab_contents;
+
+                std::shared_ptr<WillowTwoPlayerSaveGame> save_game;
+                std::unique_ptr<Borderlands2::Edit::EditHistory> history;
+                std::shared_ptr<const std::vector<uint8_t>> save_payload;
+                std::shared_ptr<const std::vector<Borderlands2::WireFormat::FieldSpan>> save_fields;
+                QString save_path;
+            };
+        }
+    }
+}
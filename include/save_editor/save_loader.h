@@ -0,0 +1,108 @@
+/*!
+ * @brief This file defines the background loader for save files.
+ *
+ * @author David Oberacker
+ *
+ * @date 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QFutureWatcher>
+#include <QObject>
+#include <QString>
+
+#include <borderlands2/wire_format.hpp>
+
+class WillowTwoPlayerSaveGame;
+
+namespace D4v3 {
+    namespace Borderlands {
+
+        /*!
+         * @brief Namespace for the classes of the save editor application.
+         */
+        namespace SaveEditor {
+
+            /*!
+             * @brief A loaded save together with the payload it was parsed from.
+             */
+            struct LoadedSave {
+                /*!
+                 * @brief The loaded save, owned by the receiver of loaded once the load finished.
+                 */
+                std::shared_ptr<WillowTwoPlayerSaveGame> save_game;
+
+                /*!
+                 * @brief The decoded protobuf payload of the save.
+                 */
+                std::shared_ptr<const std::vector<uint8_t>> payload;
+
+                /*!
+                 * @brief The field index of the payload, nullptr if it could not be built.
+                 */
+                std::shared_ptr<const std::vector<Borderlands2::WireFormat::FieldSpan>> fields;
+            };
+
+            /*!
+             * @brief Loads save files on a worker thread of the global thread pool.
+             *
+             * @details Reading, decompressing, decoding and parsing a save as well as indexing its payload all run
+             *  on the worker. The stage the worker is in is reported with stageChanged, the finished save is handed
+             *  to the owning thread with loaded. Only one save is loaded at a time.
+             */
+            class SaveLoader : public QObject {
+                Q_OBJECT
+
+            public:
+                explicit SaveLoader(QObject* parent = nullptr);
+
+                /*!
+                 * @brief Waits for a running load, the worker reports to this object.
+                 */
+                ~SaveLoader() override;
+
+                /*!
+                 * @brief Starts loading the save at path in the background.
+                 *
+                 * @param path The path of the save file.
+                 * @return true if the load was started, false if another load is still running.
+                 */
+                bool load(const QString& path);
+
+                /*!
+                 * @brief Checks if a load is running.
+                 */
+                bool isLoading() const;
+
+            signals:
+                /*!
+                 * @brief Emitted from the worker thread when a new load stage is entered.
+                 *
+                 * @param stage The D4v3::Borderlands::Borderlands2::LoadStage entered.
+                 */
+                void stageChanged(int stage);
+
+                /*!
+                 * @brief Emitted on the owning thread when a save was loaded successfully.
+                 */
+                void loaded(const LoadedSave& save, const QString& path);
+
+                /*!
+                 * @brief Emitted on the owning thread when a save could not be loaded.
+                 */
+                void failed(const QString& path);
+
+            private slots:
+                void onFinished();
+
+            private:
+                QFutureWatcher<LoadedSave> watcher;
+                QString path;
+            };
+        }
+    }
+}
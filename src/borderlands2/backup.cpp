@@ -0,0 +1,400 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/backup.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <thread>
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <zip.h>
+#include <zlib.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+/*!
+ * @brief The largest entry that is restored, the limit of the decoded data of a save.
+ *
+ * @details The uncompressed size is read from the archive and allocated before the entry is decompressed, so
+ *  it is checked against this limit first.
+ */
+constexpr zip_uint64_t MAX_ENTRY_SIZE = 64 * 1024 * 1024;
+
+/*!
+ * @brief A file of the save directory, deflated on a worker thread.
+ */
+struct CompressedEntry {
+    boost::filesystem::path path;
+    std::string name;
+    std::time_t mtime = 0;
+    uint64_t size = 0;
+    uint32_t crc = 0;
+
+    /*!
+     * @brief The raw deflate stream as stored in the zip archive.
+     */
+    std::vector<uint8_t> data;
+};
+
+/*!
+ * @brief State of a zip source serving an already compressed entry.
+ */
+struct PrecompressedSource {
+    const CompressedEntry *entry;
+    uint64_t offset;
+    zip_error_t error;
+};
+
+using ZipArchive = std::unique_ptr<zip_t, decltype(&zip_discard)>;
+
+/*!
+ * @brief Opens a zip archive and logs the libzip error on failure.
+ */
+ZipArchive openArchive(const std::string &path, int flags) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    int error_code = 0;
+    ZipArchive archive(zip_open(path.c_str(), flags, &error_code), &zip_discard);
+    if (!archive) {
+        zip_error_t error;
+        zip_error_init_with_code(&error, error_code);
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to open archive " << path << ": " << zip_error_strerror(&error);
+        zip_error_fini(&error);
+    }
+    return archive;
+}
+
+/*!
+ * @brief Reads a file and deflates it into entry->data.
+ *
+ * @details Called from the worker threads, every entry is only touched by one thread.
+ */
+bool compressEntry(CompressedEntry *entry) noexcept {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    try {
+        std::vector<uint8_t> input(boost::filesystem::file_size(entry->path));
+        boost::filesystem::ifstream stream(entry->path, std::ios::in | std::ios::binary);
+        if (!stream.read(reinterpret_cast<char *>(input.data()), (std::streamsize) input.size())) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to read " << entry->path;
+            return false;
+        }
+        entry->mtime = boost::filesystem::last_write_time(entry->path);
+        entry->size = input.size();
+        entry->crc = (uint32_t) crc32(crc32(0L, Z_NULL, 0), input.data(), (uInt) input.size());
+
+        // Zip entries hold raw deflate streams without the zlib header, selected by negative window bits.
+        z_stream deflate_stream{};
+        if (deflateInit2(&deflate_stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            return false;
+        }
+        entry->data.resize(deflateBound(&deflate_stream, (uLong) input.size()));
+        deflate_stream.next_in = input.data();
+        deflate_stream.avail_in = (uInt) input.size();
+        deflate_stream.next_out = entry->data.data();
+        deflate_stream.avail_out = (uInt) entry->data.size();
+
+        const int result = deflate(&deflate_stream, Z_FINISH);
+        entry->data.resize(deflate_stream.total_out);
+        deflateEnd(&deflate_stream);
+        if (result != Z_STREAM_END) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to compress " << entry->path << ": " << result;
+            return false;
+        }
+        return true;
+    } catch (std::exception &ex) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to compress " << entry->path << ": " << ex.what();
+        return false;
+    }
+}
+
+/*!
+ * @brief Callback of the zip source serving a CompressedEntry.
+ *
+ * @details The stat reports the deflate method with the sizes and the CRC of the original file, so libzip
+ *  copies the data into the archive as it is instead of compressing it again.
+ */
+zip_int64_t precompressedSource(void *userdata, void *data, zip_uint64_t length, zip_source_cmd_t command) {
+    auto *source = static_cast<PrecompressedSource *>(userdata);
+    const CompressedEntry *entry = source->entry;
+
+    switch (command) {
+        case ZIP_SOURCE_OPEN:
+            source->offset = 0;
+            return 0;
+        case ZIP_SOURCE_READ: {
+            const uint64_t count = std::min<uint64_t>(length, entry->data.size() - source->offset);
+            std::memcpy(data, entry->data.data() + source->offset, (size_t) count);
+            source->offset += count;
+            return (zip_int64_t) count;
+        }
+        case ZIP_SOURCE_CLOSE:
+            return 0;
+        case ZIP_SOURCE_STAT: {
+            if (length < sizeof(zip_stat_t)) {
+                zip_error_set(&source->error, ZIP_ER_INVAL, 0);
+                return -1;
+            }
+            auto *stat = static_cast<zip_stat_t *>(data);
+            zip_stat_init(stat);
+            stat->valid = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_CRC | ZIP_STAT_MTIME;
+            stat->size = entry->size;
+            stat->comp_size = entry->data.size();
+            stat->comp_method = ZIP_CM_DEFLATE;
+            stat->crc = entry->crc;
+            stat->mtime = entry->mtime;
+            return sizeof(zip_stat_t);
+        }
+        case ZIP_SOURCE_ERROR:
+            return zip_error_to_data(&source->error, data, length);
+        case ZIP_SOURCE_FREE:
+            zip_error_fini(&source->error);
+            delete source;
+            return 0;
+        case ZIP_SOURCE_SUPPORTS:
+            return zip_source_make_command_bitmap(ZIP_SOURCE_OPEN, ZIP_SOURCE_READ, ZIP_SOURCE_CLOSE, ZIP_SOURCE_STAT,
+                                                  ZIP_SOURCE_ERROR, ZIP_SOURCE_FREE, -1);
+        default:
+            zip_error_set(&source->error, ZIP_ER_OPNOTSUPP, 0);
+            return -1;
+    }
+}
+
+/*!
+ * @brief Decompresses one entry and writes it to the save directory.
+ */
+bool restoreEntry(zip_t *archive, zip_uint64_t index, const boost::filesystem::path &save_directory) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    zip_stat_t stat;
+    if (zip_stat_index(archive, index, 0, &stat) != 0 || (stat.valid & ZIP_STAT_NAME) == 0 ||
+        (stat.valid & ZIP_STAT_SIZE) == 0) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to read entry " << index << ": " << zip_strerror(archive);
+        return false;
+    }
+
+    // Backups only hold files of a single directory, names with a path would be written outside of it.
+    const boost::filesystem::path name(stat.name);
+    if (name.filename() != name || name.filename_is_dot() || name.filename_is_dot_dot()) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Skipping entry with invalid name: " << stat.name;
+        return false;
+    }
+
+    if (stat.size > MAX_ENTRY_SIZE) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Skipping entry " << stat.name << " of " << stat.size << " bytes, the limit is " << MAX_ENTRY_SIZE;
+        return false;
+    }
+
+    std::vector<uint8_t> data((size_t) stat.size);
+    zip_file_t *file = zip_fopen_index(archive, index, 0);
+    if (file == nullptr) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to open entry " << stat.name << ": " << zip_strerror(archive);
+        return false;
+    }
+    const zip_int64_t read = zip_fread(file, data.data(), data.size());
+    zip_fclose(file);
+    if (read < 0 || (zip_uint64_t) read != stat.size) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to decompress entry " << stat.name;
+        return false;
+    }
+
+    const boost::filesystem::path target = save_directory / name;
+    boost::filesystem::path temporary = target;
+    temporary += ".restore";
+    // The temporary file is removed on every failure, a rename error is returned instead of thrown for that.
+    boost::system::error_code error;
+    {
+        boost::filesystem::ofstream stream(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(data.data()), (std::streamsize) data.size());
+        stream.close();
+        if (!stream.good()) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to write " << temporary;
+            boost::filesystem::remove(temporary, error);
+            return false;
+        }
+    }
+    boost::filesystem::rename(temporary, target, error);
+    if (error) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to replace " << target << ": " << error.message();
+        boost::filesystem::remove(temporary, error);
+        return false;
+    }
+    if ((stat.valid & ZIP_STAT_MTIME) != 0) {
+        boost::filesystem::last_write_time(target, stat.mtime);
+    }
+
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
+        << "Restored " << target;
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Backup::backupSaves(const std::string &save_directory, const std::string &archive_path,
+                                                     unsigned int threads) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    if (!boost::filesystem::is_directory(save_directory)) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Save directory does not exist: " << save_directory;
+        return false;
+    }
+
+    std::vector<CompressedEntry> entries;
+    for (const auto &file : boost::filesystem::directory_iterator(save_directory)) {
+        if (boost::filesystem::is_regular_file(file.status())) {
+            CompressedEntry entry;
+            entry.path = file.path();
+            entry.name = file.path().filename().string();
+            entries.push_back(std::move(entry));
+        }
+    }
+    if (entries.empty()) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "No files to back up in: " << save_directory;
+        return false;
+    }
+    std::sort(entries.begin(), entries.end(), [](const CompressedEntry &a, const CompressedEntry &b) {
+        return a.name < b.name;
+    });
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min<unsigned int>(threads, (unsigned int) entries.size());
+
+    std::atomic<size_t> next_entry(0);
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threads; ++i) {
+        workers.emplace_back([&]() {
+            for (size_t entry = next_entry++; entry < entries.size(); entry = next_entry++) {
+                if (!compressEntry(&entries[entry])) {
+                    failed = true;
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    if (failed) {
+        return false;
+    }
+
+    ZipArchive archive = openArchive(archive_path, ZIP_CREATE | ZIP_TRUNCATE);
+    if (!archive) {
+        return false;
+    }
+
+    for (const CompressedEntry &entry : entries) {
+        auto *state = new PrecompressedSource{&entry, 0, {}};
+        zip_error_init(&state->error);
+        zip_source_t *source = zip_source_function(archive.get(), precompressedSource, state);
+        if (source == nullptr) {
+            zip_error_fini(&state->error);
+            delete state;
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to create zip source: " << zip_strerror(archive.get());
+            return false;
+        }
+        if (zip_file_add(archive.get(), entry.name.c_str(), source, ZIP_FL_ENC_UTF_8 | ZIP_FL_OVERWRITE) < 0) {
+            zip_source_free(source);
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to add " << entry.name << " to archive: " << zip_strerror(archive.get());
+            return false;
+        }
+    }
+
+    // The entries are written one after the other when the archive is closed, the sources point into entries.
+    if (zip_close(archive.get()) != 0) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to write archive " << archive_path << ": " << zip_strerror(archive.get());
+        return false;
+    }
+    archive.release();
+
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
+        << "Backed up " << entries.size() << " files to " << archive_path;
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Backup::listBackup(const std::string &archive_path,
+                                                    std::vector<std::string> *names) noexcept(false) {
+    ZipArchive archive = openArchive(archive_path, ZIP_RDONLY);
+    if (!archive) {
+        return false;
+    }
+
+    names->clear();
+    const zip_int64_t count = zip_get_num_entries(archive.get(), 0);
+    for (zip_int64_t index = 0; index < count; ++index) {
+        const char *name = zip_get_name(archive.get(), (zip_uint64_t) index, 0);
+        if (name != nullptr) {
+            names->emplace_back(name);
+        }
+    }
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Backup::restoreSaves(const std::string &archive_path, const std::string &save_directory,
+                                                      const std::vector<std::string> &names) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    ZipArchive archive = openArchive(archive_path, ZIP_RDONLY);
+    if (!archive) {
+        return false;
+    }
+
+    bool success = true;
+    std::vector<zip_uint64_t> indices;
+    if (names.empty()) {
+        const zip_int64_t count = zip_get_num_entries(archive.get(), 0);
+        for (zip_int64_t index = 0; index < count; ++index) {
+            indices.push_back((zip_uint64_t) index);
+        }
+    }
+    for (const std::string &name : names) {
+        zip_int64_t index = zip_name_locate(archive.get(), name.c_str(), 0);
+        if (index < 0) {
+            index = zip_name_locate(archive.get(), (name + ".sav").c_str(), 0);
+        }
+        if (index < 0) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Save " << name << " is not part of the backup " << archive_path;
+            success = false;
+            continue;
+        }
+        indices.push_back((zip_uint64_t) index);
+    }
+
+    boost::filesystem::create_directories(save_directory);
+    for (zip_uint64_t index : indices) {
+        success = restoreEntry(archive.get(), index, save_directory) && success;
+    }
+    return success;
+}
@@ -12,8 +12,8 @@
 #include <boost/log/trivial.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
-#include <boost/interprocess/streams/bufferstream.hpp>
 
+#include <openssl/evp.h>
 #include <openssl/sha.h>
 #include <minilzo-2.10/minilzo.h>
 
@@ -23,339 +23,575 @@
 BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
 
 /*!
- * @brief Gets the data and the checksum from a input file stream.
+ * @brief The size of the blocks a save file is read and hashed in.
+ */
+constexpr size_t SAVE_FILE_BLOCK_SIZE = 64 * 1024;
+
+/*!
+ * @brief Checks that a path leads to a regular file with the '.sav' extension.
  *
- * The checksum are always the first checksum_size bytes of the file and data are the data_size bytes following.
- * @param[in] istream The file stream to read from! If this is invalid the function throws a error.
- * @param[out] checksum A pointer to the start of a array that will contain the checksum. The array has to be preallocated with size == checksum_size.
- * @param[in] checksum_size The size of the checksum. For SHA sums this should be 20.
- * @param[out] data A pointer to the start of a array that will contain the data. The array has to be preallocated with size == data_size.
- * @param[in] data_size The size of the data.
+ * @param[in] path The path to check.
+ * @param[out] save_file The absolute path of the save file.
  *
- * @throw std::invalid_argument If the given input stream is not accessible this exception is thrown.
+ * @throw std::runtime_error If the path can not be made absolute.
  *
- * @return true on success, else otherwise
+ * @return true iff the path leads to a '.sav' file, else false.
  */
-bool getDataFromFile(boost::filesystem::ifstream *istream,
-                     uint8_t *checksum, uint64_t checksum_size,
-                     uint8_t *data, uint64_t data_size) noexcept(false) {
-
+bool getSaveFilePath(const std::string &path, boost::filesystem::path *save_file) noexcept(false) {
     boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
 
-    if (!istream->is_open()) {
+    *save_file = boost::filesystem::path(path);
+
+    if (!boost::filesystem::exists(*save_file)) {
         BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "The given filestream in invalid!";
-        throw std::invalid_argument("The given input stream is invalid!");
+            << "Invalid path specified";
+        return false;
     }
 
-    char* checksum_read = new char[20];
-    memset(checksum_read, 0 , 20);
+    if (!boost::filesystem::is_regular_file(*save_file)) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Specified path does not lead to a file!";
+        return false;
+    }
 
-    (*istream).read(checksum_read, 20);
-    if ((*istream).rdstate() != 0) {
+    if ((save_file->extension().generic_string() != ".sav")) {
         BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "The previous read operation on the stream failed!";
-        if (((*istream).rdstate() & boost::filesystem::ifstream::eofbit) != 0) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "EOF was encountered while reading " << checksum_size << " bytes!";
-        }
+            << "Specified path does not lead to a sav file!";
         return false;
     }
 
-    memcpy(checksum, checksum_read, 20);
-    delete [] checksum_read;
-    checksum_read = nullptr;
+    if (!save_file->is_absolute()) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Making specified path absolute!";
+        try {
+            *save_file = boost::filesystem::absolute(*save_file);
+        } catch (boost::filesystem::filesystem_error &ex) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error) << ex.what();
+            throw std::runtime_error(ex.what());
+        }
+    }
 
-    char* data_read = new char[data_size];
-    memset(data_read, 0 , data_size);
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Save file path: " << *save_file;
 
-    (*istream).read(data_read, data_size);
-    int32_t istream_state = (int32_t) (*istream).rdstate();
+    return true;
+}
 
-    if (istream_state != 0) {
-        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Failed to read: " << data_size << " bytes! Could only read: " << (*istream).gcount() << " bytes!";
-        if ((istream_state & boost::filesystem::ifstream::eofbit) != 0) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "EOF was encountered!";
+/*!
+ * @brief Checks that a path leads to a regular file with the '.sav' extension, without logging or throwing.
+ */
+D4v3::Borderlands::Borderlands2::SaveError checkSaveFilePath(const boost::filesystem::path &save_file) noexcept(false) {
+    using D4v3::Borderlands::Borderlands2::SaveError;
+
+    boost::system::error_code error;
+    if (!boost::filesystem::is_regular_file(save_file, error)) {
+        return SaveError::bad_path;
+    }
+    if (save_file.extension() != ".sav") {
+        return SaveError::bad_extension;
+    }
+    return SaveError::no_error;
+}
+
+/*!
+ * @brief Reads a save file block wise and verifies the SHA1 checksum at its beginning.
+ *
+ * @details The checksum is updated with every block as it is read, so hashing overlaps with the file I/O and no
+ *  second pass over the data is needed. OpenSSL's EVP interface is used to pick up SHA extensions of the CPU.
+ *  Nothing is logged, the caller decides if the failure is worth a message.
+ *
+ * @param[in] save_file The path of the save file.
+ * @param[out] data If not null, the data following the checksum is stored in it. With a null pointer only one
+ *  block is held in memory at a time, which is used to verify files without loading them.
+ *
+ * @return no_error iff the file could be read and the checksum is valid, else the reason it failed.
+ */
+D4v3::Borderlands::Borderlands2::SaveError
+readSaveFileData(const boost::filesystem::path &save_file, std::vector<uint8_t> *data) noexcept(false) {
+    using D4v3::Borderlands::Borderlands2::SaveError;
+
+    boost::filesystem::ifstream save_file_stream(save_file, boost::filesystem::ifstream::in | boost::filesystem::ifstream::binary);
+    if (!save_file_stream.is_open()) {
+        return SaveError::read_failed;
+    }
+
+    uint8_t checksum[SHA_DIGEST_LENGTH];
+    save_file_stream.read(reinterpret_cast<char *>(checksum), SHA_DIGEST_LENGTH);
+    if (save_file_stream.gcount() != SHA_DIGEST_LENGTH) {
+        return SaveError::truncated;
+    }
+
+    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> context(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+    if (!context || EVP_DigestInit_ex(context.get(), EVP_sha1(), nullptr) != 1) {
+        return SaveError::read_failed;
+    }
+
+    std::vector<uint8_t> block;
+    if (data != nullptr) {
+        boost::system::error_code error;
+        const uintmax_t file_size = boost::filesystem::file_size(save_file, error);
+        data->clear();
+        if (!error && file_size > SHA_DIGEST_LENGTH) {
+            data->reserve(file_size - SHA_DIGEST_LENGTH);
         }
-        if ((istream_state & boost::filesystem::ifstream::badbit) != 0) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "BadBit was encountered!";
+    } else {
+        block.resize(SAVE_FILE_BLOCK_SIZE);
+    }
+
+    while (save_file_stream) {
+        uint8_t* target;
+        if (data != nullptr) {
+            size_t offset = data->size();
+            data->resize(offset + SAVE_FILE_BLOCK_SIZE);
+            target = data->data() + offset;
+        } else {
+            target = block.data();
         }
-        if ((istream_state & boost::filesystem::ifstream::failbit) != 0) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "FailBit was encountered!";
+
+        save_file_stream.read(reinterpret_cast<char *>(target), SAVE_FILE_BLOCK_SIZE);
+        auto read = (size_t) save_file_stream.gcount();
+
+        if (data != nullptr) {
+            data->resize(data->size() - SAVE_FILE_BLOCK_SIZE + read);
         }
+
+        EVP_DigestUpdate(context.get(), target, read);
+    }
+
+    if (save_file_stream.bad()) {
+        return SaveError::read_failed;
+    }
+
+    uint8_t checksum_data[EVP_MAX_MD_SIZE];
+    unsigned int checksum_data_size = 0;
+    EVP_DigestFinal_ex(context.get(), checksum_data, &checksum_data_size);
+
+    if (memcmp(checksum, checksum_data, SHA_DIGEST_LENGTH) != 0) {
+        return SaveError::sha1_mismatch;
+    }
+
+    return SaveError::no_error;
+}
+
+/*!
+ * @brief The WSG header in front of the Huffman encoded save payload.
+ */
+struct InnerHeader {
+    uint32_t size;
+    uint32_t version;
+    D4v3::Borderlands::Common::Streams::Endian endianess;
+    uint32_t hash;
+    int32_t uncompressed_size;
+    const uint8_t* payload;
+    size_t payload_size;
+};
+
+/*!
+ * @brief Reads the fields following the version with the byte order known at compile time.
+ */
+template<D4v3::Borderlands::Common::Streams::Endian E>
+void readInnerHeaderFields(D4v3::Borderlands::Common::Streams::ByteReader *reader, InnerHeader *header) noexcept(false) {
+    header->endianess = E;
+    header->hash = reader->read<uint32_t, E>();
+    header->uncompressed_size = reader->read<int32_t, E>();
+}
+
+/*!
+ * @brief Size of the inner header fields in front of the payload.
+ */
+constexpr size_t INNER_HEADER_SIZE = 4 + 3 + 4 + 4 + 4;
+
+/*!
+ * @brief The largest accepted LZO decompressed or Huffman decoded size, real saves are far below 1 MB.
+ *
+ * @details Both sizes are read from the file and allocated before the data is decoded, so they are checked
+ *  against this limit first.
+ */
+constexpr size_t MAX_DECODED_SIZE = 64 * 1024 * 1024;
+
+/*!
+ * @brief Parses the WSG inner header of the LZO decompressed save data.
+ *
+ * @details The version is stored in the byte order of the platform the save was written on, it is 2 when read as
+ *  little endian for PC saves and all following fields use the same byte order. The payload is not copied, the
+ *  header points into the given array. All sizes are checked up front, so malformed data is rejected without an
+ *  exception, and the uncompressed size is at most what the payload can decode to.
+ *
+ * @param[in] data The LZO decompressed save data.
+ * @param[in] size The size of data.
+ * @param[out] header The parsed header.
+ * @return true on success, false if the data is truncated or not a WSG payload.
+ */
+bool readInnerHeader(const uint8_t *data, size_t size, InnerHeader *header) noexcept(false) {
+    if (size < INNER_HEADER_SIZE) {
         return false;
     }
 
-    memcpy(data, data_read, data_size);
-    delete[] data_read;
-    data_read = nullptr;
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, size);
+    header->size = reader.read<uint32_t, D4v3::Borderlands::Common::Streams::Endian::big_endian>();
 
+    const uint8_t* magic_number = reader.read_bytes(3);
+    if (memcmp(magic_number, "WSG", 3) != 0) {
+        return false;
+    }
+
+    header->version = reader.read<uint32_t, D4v3::Borderlands::Common::Streams::Endian::little_endian>();
+    if (header->version != 2) {
+        header->version = D4v3::Borderlands::Common::Streams::byte_swap(header->version);
+        readInnerHeaderFields<D4v3::Borderlands::Common::Streams::Endian::big_endian>(&reader, header);
+    } else {
+        readInnerHeaderFields<D4v3::Borderlands::Common::Streams::Endian::little_endian>(&reader, header);
+    }
+
+    if (header->size < INNER_HEADER_SIZE - 4 || header->uncompressed_size < 0 ||
+        header->size - (INNER_HEADER_SIZE - 4) > reader.remaining()) {
+        return false;
+    }
+
+    header->payload_size = header->size - (INNER_HEADER_SIZE - 4);
+
+    // Every Huffman code takes at least one bit.
+    if ((size_t) header->uncompressed_size > 8 * header->payload_size ||
+        (size_t) header->uncompressed_size > MAX_DECODED_SIZE) {
+        return false;
+    }
+    header->payload = reader.read_bytes(header->payload_size);
     return true;
 }
 
+/*!
+ * @brief Maps the result of lzo1x_decompress_safe to a SaveError.
+ */
+D4v3::Borderlands::Borderlands2::SaveError lzoError(int result) noexcept {
+    using D4v3::Borderlands::Borderlands2::SaveError;
+
+    switch (result) {
+        case LZO_E_OK:
+            return SaveError::no_error;
+        case LZO_E_INPUT_OVERRUN:
+            return SaveError::lzo_input_overrun;
+        case LZO_E_OUTPUT_OVERRUN:
+            return SaveError::lzo_output_overrun;
+        case LZO_E_LOOKBEHIND_OVERRUN:
+            return SaveError::lzo_lookbehind_overrun;
+        default:
+            return SaveError::lzo_failed;
+    }
+}
+
+BORDERLANDS2_SAVE_EDITOR_API const char *
+D4v3::Borderlands::Borderlands2::saveErrorName(SaveError error) noexcept {
+    switch (error) {
+        case SaveError::no_error:
+            return "no error";
+        case SaveError::bad_path:
+            return "not a file";
+        case SaveError::bad_extension:
+            return "not a .sav file";
+        case SaveError::read_failed:
+            return "read failed";
+        case SaveError::truncated:
+            return "truncated";
+        case SaveError::sha1_mismatch:
+            return "SHA1 checksum mismatch";
+        case SaveError::lzo_input_overrun:
+            return "LZO input overrun";
+        case SaveError::lzo_output_overrun:
+            return "LZO output overrun";
+        case SaveError::lzo_lookbehind_overrun:
+            return "LZO lookbehind overrun";
+        case SaveError::lzo_failed:
+            return "LZO decompression failed";
+        case SaveError::bad_inner_header:
+            return "invalid WSG header";
+        case SaveError::huffman_overrun:
+            return "Huffman data overrun";
+        case SaveError::inner_hash_mismatch:
+            return "inner hash mismatch";
+        case SaveError::parse_failed:
+            return "deserialization failed";
+    }
+    return "unknown error";
+}
+
 bool BORDERLANDS2_SAVE_EDITOR_API verifySave(const std::string &path) noexcept(false) {
 
     boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
     BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Verifying savefile!";
 
-    if (!isSaveFile(path)) {
+    WillowTwoPlayerSaveGame save_game;
+    D4v3::Borderlands::Borderlands2::SaveReader reader;
+    return reader.read(path, &save_game);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::readSave(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                          const LoadProgressCallback &progress) noexcept(false) {
+    SaveReader reader;
+    return reader.read(path, save_game, progress);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::readSave(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                          std::vector<uint8_t> *payload,
+                                          const LoadProgressCallback &progress) noexcept(false) {
+    SaveReader reader;
+    return reader.read(path, save_game, payload, progress);
+}
+
+const std::vector<uint8_t> &D4v3::Borderlands::Borderlands2::SaveReader::payload() const noexcept {
+    return decoded_payload;
+}
+
+bool D4v3::Borderlands::Borderlands2::SaveReader::read(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                                       const LoadProgressCallback &progress) noexcept(false) {
+    return read(path, save_game, nullptr, progress);
+}
+
+bool D4v3::Borderlands::Borderlands2::SaveReader::read(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                                       std::vector<uint8_t> *payload,
+                                                       const LoadProgressCallback &progress) noexcept(false) {
+
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Reading savefile!";
+
+    const SaveError error = decode(path, save_game, payload != nullptr ? payload : &decoded_payload, progress);
+    if (error != SaveError::no_error) {
         BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Invalid path specified";
+            << "Failed to read save file " << path << ": " << saveErrorName(error) << "!";
         return false;
     }
 
-    std::unique_ptr<boost::filesystem::path> save_file = std::make_unique<boost::filesystem::path>(path);
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
+        << "Read save file at: " << path << "! ";
+    return true;
+}
 
-    if (!save_file->is_absolute()) {
-        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Making specified path absolute!";
-        try {
-            boost::filesystem::path canonical_path = boost::filesystem::absolute(*(save_file));
-            save_file.reset(nullptr);
-            save_file = std::make_unique<boost::filesystem::path>(canonical_path);
-        } catch (boost::filesystem::filesystem_error &ex) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error) << ex.what();
-            throw std::runtime_error(ex.what());
+D4v3::Borderlands::Borderlands2::SaveError
+D4v3::Borderlands::Borderlands2::SaveReader::check(const std::string &path, bool parse) noexcept {
+    try {
+        if (!parse) {
+            return decode(path, nullptr, &decoded_payload, nullptr);
         }
+        WillowTwoPlayerSaveGame save_game;
+        return decode(path, &save_game, &decoded_payload, nullptr);
+    } catch (std::bad_alloc &) {
+        // The sizes claimed by the file are bounded before allocating, so this is only reached out of memory.
+        return SaveError::read_failed;
     }
+}
 
+D4v3::Borderlands::Borderlands2::SaveError
+D4v3::Borderlands::Borderlands2::SaveReader::decode(const std::string &path, WillowTwoPlayerSaveGame *save_game,
+                                                    std::vector<uint8_t> *payload,
+                                                    const LoadProgressCallback &progress) noexcept(false) {
+    auto report = [&progress](LoadStage stage) {
+        if (progress) {
+            progress(stage);
+        }
+    };
 
-    boost::filesystem::ifstream save_file_stream(*save_file, boost::filesystem::ifstream::in | boost::filesystem::ifstream::binary);
-    size_t size = boost::filesystem::file_size(*save_file) - 20;
-    auto* checksum = new uint8_t[20];
-    memset(checksum, 0, 20);
+    report(LoadStage::reading_file);
 
-    auto* data = new uint8_t[size];
-    memset(data, 0, size);
+    const boost::filesystem::path save_file(path);
+    SaveError error = checkSaveFilePath(save_file);
+    if (error != SaveError::no_error) {
+        return error;
+    }
 
-    if(!getDataFromFile(&save_file_stream, checksum, 20, data, size)) {
-        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error) << "Could not get data from file!";
-        return false;
+    error = readSaveFileData(save_file, &file_data);
+    if (error != SaveError::no_error) {
+        return error;
+    }
+    if (file_data.size() < sizeof(uint32_t)) {
+        return SaveError::truncated;
     }
 
-    save_file_stream.close();
-    save_file.reset(nullptr);
+    D4v3::Borderlands::Common::Streams::ByteReader data_reader(file_data.data(), file_data.size());
+    lzo_uint uncompressed_size = data_reader.read<uint32_t, D4v3::Borderlands::Common::Streams::Endian::big_endian>();
+    const size_t compressed_size = data_reader.remaining();
+    const uint8_t* compressed_data = data_reader.read_bytes(compressed_size);
 
-    delete[] checksum;
-    checksum = nullptr;
+    report(LoadStage::decompressing);
 
-    size_t uncompressed_size = 0;
-    uncompressed_size = data[0] << 24 | data[1] << 16 | data[2] << 8 | data[3];
+    if (uncompressed_size > MAX_DECODED_SIZE) {
+        return SaveError::truncated;
+    }
+    uncompressed_data.resize(uncompressed_size);
+    error = lzoError(lzo1x_decompress_safe(compressed_data, compressed_size, uncompressed_data.data(), &uncompressed_size, nullptr));
+    if (error != SaveError::no_error) {
+        return error;
+    }
 
-    auto* uncompressed_data = new unsigned char[uncompressed_size];
-    memset(uncompressed_data, 0, uncompressed_size);
+    InnerHeader inner_header;
+    if (!readInnerHeader(uncompressed_data.data(), uncompressed_size, &inner_header)) {
+        return SaveError::bad_inner_header;
+    }
 
-    size_t compressed_size = size - 4;
-    auto* compressed_data = new unsigned char[compressed_size];
-    memset(compressed_data, 0, compressed_size);
-    memcpy(compressed_data, data + 4, compressed_size);
+    report(LoadStage::huffman_decoding);
 
-    delete[] data;
-    data = nullptr;
+    // The payload is decoded straight into the caller's buffer if it wants to keep it.
+    payload->assign((size_t) inner_header.uncompressed_size, 0);
 
-    switch (lzo1x_decompress_safe(compressed_data, compressed_size, uncompressed_data, &uncompressed_size, nullptr)) {
-        case LZO_E_OK:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
-                << "LZO decompression successful!"
-                << " Uncompressed size (byte): " << uncompressed_size;
-            break;
-        case LZO_E_OUT_OF_MEMORY:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Out of memory!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_INPUT_OVERRUN:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Input overrun!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_OUTPUT_OVERRUN:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Output overrun!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_LOOKBEHIND_OVERRUN:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Lookbehind overrun!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_EOF_NOT_FOUND:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! EOF not found!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_INPUT_NOT_CONSUMED:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Input not consumed!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_INVALID_ARGUMENT:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Invalid Argument!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_INVALID_ALIGNMENT:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Output Alignment!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        case LZO_E_OUTPUT_NOT_CONSUMED:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed! Output not consumeds!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
-        default:
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "LZO decompression failed!"
-                << " Failure at byte: " << uncompressed_size;
-            return false;
+    if (!D4v3::Borderlands::Common::Huffman::decode(reinterpret_cast<const char *>(inner_header.payload), (uint32_t) inner_header.payload_size,
+                                                    reinterpret_cast<char *>(payload->data()), inner_header.uncompressed_size)) {
+        return SaveError::huffman_overrun;
     }
 
+    uint32_t hash = D4v3::Borderlands::Common::Checksum::crc32(payload->data(), payload->size());
+    if (hash != inner_header.hash) {
+        return SaveError::inner_hash_mismatch;
+    }
 
-    //Freeing compressed data space.
-    delete[] compressed_data;
-    compressed_data = nullptr;
+    if (save_game == nullptr) {
+        report(LoadStage::finished);
+        return SaveError::no_error;
+    }
 
-    auto* uncompressed_data_char = reinterpret_cast<char *>(uncompressed_data);
+    report(LoadStage::parsing);
 
+    if (!save_game->ParseFromArray(payload->data(), (int) payload->size())) {
+        return SaveError::parse_failed;
+    }
 
-    boost::interprocess::bufferstream input_stream(uncompressed_data_char, uncompressed_size);
+    report(LoadStage::finished);
 
-    uint32_t innerSize = 0;
-    D4v3::Borderlands::Common::Streams::read_uint32(&input_stream, &innerSize, D4v3::Borderlands::Common::Streams::Endian::big_endian);
+    return SaveError::no_error;
+}
 
-    char magicNumber[3];
-    memset(magicNumber, 0 ,3);
-    input_stream.read(magicNumber, 3);
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::encodeSave(const WillowTwoPlayerSaveGame &save_game, std::vector<uint8_t> *output,
+                                            D4v3::Borderlands::Common::Streams::Endian endianess) noexcept(false) {
+    SaveWriter writer(endianess);
+    return writer.encode(save_game, output);
+}
 
-    uint32_t version = 0;
-    D4v3::Borderlands::Common::Streams::read_uint32(&input_stream, &version, D4v3::Borderlands::Common::Streams::Endian::little_endian);
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::writeSave(const WillowTwoPlayerSaveGame &save_game, const std::string &path,
+                                           D4v3::Borderlands::Common::Streams::Endian endianess) noexcept(false) {
+    SaveWriter writer(endianess);
+    return writer.write(save_game, path);
+}
 
-    D4v3::Borderlands::Common::Streams::Endian endianess;
-    if (version != 2) {
-        endianess = D4v3::Borderlands::Common::Streams::Endian::big_endian;
-    } else {
-        endianess = D4v3::Borderlands::Common::Streams::Endian::little_endian;
+D4v3::Borderlands::Borderlands2::SaveWriter::SaveWriter(D4v3::Borderlands::Common::Streams::Endian endianess) noexcept(false)
+        : endianess(endianess), work_memory(LZO1X_1_MEM_COMPRESS) {
+}
+
+bool D4v3::Borderlands::Borderlands2::SaveWriter::encode(const WillowTwoPlayerSaveGame &save_game,
+                                                         std::vector<uint8_t> *output) noexcept(false) {
+
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Encoding savefile!";
+
+    if (!save_game.IsInitialized()) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Save is missing required fields: " << save_game.InitializationErrorString();
+        return false;
     }
 
-    uint32_t hash;
-    D4v3::Borderlands::Common::Streams::read_uint32(&input_stream, &hash, endianess);
+    serialized.clear();
+    save_game.AppendToString(&serialized);
+    uint32_t hash = D4v3::Borderlands::Common::Checksum::crc32(
+            reinterpret_cast<const uint8_t *>(serialized.data()), serialized.size());
 
-    int32_t innerUncompressedSize = 0;
-    D4v3::Borderlands::Common::Streams::read_int32(&input_stream, &innerUncompressedSize, endianess);
+    uncompressed_data.clear();
+    D4v3::Borderlands::Common::Streams::ByteWriter inner_writer(&uncompressed_data);
 
-    int innerCompressedSize = innerSize - 3 - 4 - 4 - 4;
-    char* innerCompressedBytes = new char [innerCompressedSize];
-    memset(innerCompressedBytes, 0, innerCompressedSize);
-    input_stream.read(innerCompressedBytes, innerCompressedSize);
+    size_t inner_size_offset = inner_writer.reserve<uint32_t>();
+    inner_writer.write_bytes("WSG", 3);
+    inner_writer.write<uint32_t>(2, endianess);
+    inner_writer.write<uint32_t>(hash, endianess);
+    inner_writer.write<int32_t>((int32_t) serialized.size(), endianess);
 
-    delete[] uncompressed_data;
-    uncompressed_data = nullptr;
-    uncompressed_data_char = nullptr;
+    D4v3::Borderlands::Common::Huffman::encode(serialized.data(), (uint32_t) serialized.size(), &uncompressed_data);
 
-    char* innerUncompressedBytes = new char[innerUncompressedSize];
-    memset(innerUncompressedBytes, 0, innerUncompressedSize);
+    inner_writer.patch<uint32_t, D4v3::Borderlands::Common::Streams::Endian::big_endian>(
+            inner_size_offset, (uint32_t) (uncompressed_data.size() - 4));
 
-    D4v3::Borderlands::Common::Huffman::decode(innerCompressedBytes, innerCompressedSize, innerUncompressedBytes, innerUncompressedSize);
+    if (lzo_init() != LZO_E_OK) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "LZO initialization failed!";
+        return false;
+    }
 
-    WillowTwoPlayerSaveGame save_game;
-    if(!save_game.ParseFromArray(innerUncompressedBytes, innerUncompressedSize)) {
+    output->clear();
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(output);
+
+    size_t checksum_offset = writer.reserve(SHA_DIGEST_LENGTH);
+    writer.write<uint32_t, D4v3::Borderlands::Common::Streams::Endian::big_endian>((uint32_t) uncompressed_data.size());
+
+    // Worst case expansion of LZO1X for incompressible data, the unused space is given back afterwards.
+    lzo_uint compressed_size = uncompressed_data.size() + uncompressed_data.size() / 16 + 64 + 3;
+    size_t compressed_offset = writer.reserve(compressed_size);
+
+    if (lzo1x_1_compress(uncompressed_data.data(), uncompressed_data.size(),
+                         writer.at(compressed_offset, compressed_size), &compressed_size, work_memory.data()) != LZO_E_OK) {
         BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Deserialization failed!";
+            << "LZO compression failed!";
         return false;
     }
 
-    std::cout << save_game.playerclass() << std::endl;
+    writer.truncate(compressed_offset + compressed_size);
+
+    size_t data_offset = checksum_offset + SHA_DIGEST_LENGTH;
+    SHA1(writer.at(data_offset, writer.position() - data_offset), writer.position() - data_offset,
+         writer.at(checksum_offset, SHA_DIGEST_LENGTH));
+
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
+        << "Encoded savefile! Size (byte): " << output->size();
 
-    // TODO: Implement the correct separation of the save data.
     return true;
 }
 
-bool BORDERLANDS2_SAVE_EDITOR_API_NO_EXPORT isSaveFile(const std::string &path) noexcept(false) {
-    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+bool D4v3::Borderlands::Borderlands2::SaveWriter::write(const WillowTwoPlayerSaveGame &save_game,
+                                                        const std::string &path) noexcept(false) {
 
-    std::unique_ptr<boost::filesystem::path> save_file = std::make_unique<boost::filesystem::path>(path);
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
 
-    if (!boost::filesystem::exists(*(save_file))) {
-        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Invalid path specified";
+    if (!encode(save_game, &encoded)) {
         return false;
     }
 
+    boost::filesystem::ofstream save_file_stream(boost::filesystem::path(path), boost::filesystem::ofstream::out | boost::filesystem::ofstream::binary | boost::filesystem::ofstream::trunc);
 
-    if (!boost::filesystem::is_regular_file(*(save_file))) {
+    if (!save_file_stream.is_open()) {
         BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Specified path does not lead to a file!";
+            << "Could not open file for writing: " << path;
         return false;
     }
 
-    if ((save_file->extension().generic_string() != ".sav")) {
+    save_file_stream.write(reinterpret_cast<const char *>(encoded.data()), encoded.size());
+
+    if (!save_file_stream.good()) {
         BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Specified path does not lead to a sav file!";
+            << "Failed to write " << encoded.size() << " bytes to: " << path;
         return false;
     }
 
-    if (!save_file->is_absolute()) {
-        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Making specified path absolute!";
-        try {
-            boost::filesystem::path canonical_path = boost::filesystem::absolute(*(save_file));
-            save_file.reset(nullptr);
-            save_file = std::make_unique<boost::filesystem::path>(canonical_path);
-        } catch (boost::filesystem::filesystem_error &ex) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error) << ex.what();
-            throw std::runtime_error(ex.what());
-        }
-    }
-
-    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug) << "Save file path: " << *save_file;
-
-    boost::filesystem::ifstream save_file_stream(*save_file, boost::filesystem::ifstream::in | boost::filesystem::ifstream::binary);
+    save_file_stream.close();
 
-    uint64_t size = boost::filesystem::file_size(*save_file) - 20;
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
+        << "Wrote save file to: " << path << "! ";
 
-    auto* checksum = new uint8_t[20];
-    memset(checksum, 0, 20);
+    return true;
+}
 
-    auto* data = new uint8_t[size];
-    memset(data, 0, size);
+bool BORDERLANDS2_SAVE_EDITOR_API_NO_EXPORT isSaveFile(const std::string &path) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
 
-    if (!getDataFromFile(&save_file_stream, checksum, 20, data, size)) {
-        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-            << "Error getting data and checksum from file: " << *save_file << "! ";
+    boost::filesystem::path save_file;
+    if (!getSaveFilePath(path, &save_file)) {
         return false;
     }
 
-    auto* checksum_data = new uint8_t[20];
-    memset(checksum_data, 0, 20);
-
-    SHA1(data, size, checksum_data);
-
-    for (int i = 0; i < 20; ++i) {
-        if (checksum[i] != checksum_data[i]) {
-            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
-                << "SHA1 checksum invalid: Byte " << i
-                << " is not equal: Checksum(Data): " << std::hex << checksum_data[i] << " <-> "
-                << "Checksum: " << std::hex << checksum[i];
-            return false;
-        }
+    const D4v3::Borderlands::Borderlands2::SaveError error = readSaveFileData(save_file, nullptr);
+    if (error != D4v3::Borderlands::Borderlands2::SaveError::no_error) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Error verifying data and checksum of file: " << save_file << ": "
+            << D4v3::Borderlands::Borderlands2::saveErrorName(error) << "! ";
+        return false;
     }
 
-    delete[] data;
-    data = nullptr;
-    delete[] checksum;
-    checksum = nullptr;
-    delete[] checksum_data;
-    checksum_data = nullptr;
-
     BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
-        << "Validated save file at: " << *save_file << "! ";
-
-    save_file_stream.close();
-    save_file.reset(nullptr);
+        << "Validated save file at: " << save_file << "! ";
 
     return true;
 }
-
@@ -0,0 +1,427 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/daemon.hpp"
+
+#include <array>
+#include <ctime>
+#include <sstream>
+#include <vector>
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/json.hpp>
+#include <borderlands2/missions.hpp>
+#include <borderlands2/serial.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+using boost::asio::local::stream_protocol;
+
+/*!
+ * @brief Builds the "Name=Value" lines of a decoded serial.
+ */
+std::string describeSerial(const D4v3::Borderlands::Borderlands2::Serial::DecodedSerial &decoded) {
+    static const char hex_digits[] = "0123456789abcdef";
+
+    std::ostringstream stream;
+    stream << "IsWeapon=" << (decoded.is_weapon ? "true" : "false") << "\n"
+           << "Version=" << (int) decoded.version << "\n"
+           << "Seed=" << decoded.seed << "\n"
+           << "Checksum=" << decoded.checksum << "\n"
+           << "AssetLibrarySetId=" << (int) decoded.asset_library_set_id << "\n"
+           << "AssetData=";
+    for (uint8_t byte : decoded.asset_data) {
+        stream << hex_digits[byte >> 4] << hex_digits[byte & 0xF];
+    }
+    stream << "\n";
+    return stream.str();
+}
+
+/*!
+ * @brief A decoded save and the answers built from it.
+ */
+struct D4v3::Borderlands::Borderlands2::Daemon::SaveCache::Entry {
+    uintmax_t file_size = 0;
+    std::time_t write_time = 0;
+    WillowTwoPlayerSaveGame save_game;
+    std::string summary;
+
+    /*!
+     * @brief The JSON of the save, empty until it is first requested.
+     */
+    std::string json;
+};
+
+D4v3::Borderlands::Borderlands2::Daemon::SaveCache::SaveCache(size_t capacity) noexcept(false)
+        : capacity(capacity == 0 ? 1 : capacity), hit_count(0), miss_count(0),
+          mission_names(std::make_shared<Missions::MissionNames>()) {
+}
+
+D4v3::Borderlands::Borderlands2::Daemon::SaveCache::~SaveCache() = default;
+
+size_t D4v3::Borderlands::Borderlands2::Daemon::SaveCache::hits() const noexcept {
+    return hit_count;
+}
+
+size_t D4v3::Borderlands::Borderlands2::Daemon::SaveCache::misses() const noexcept {
+    return miss_count;
+}
+
+D4v3::Borderlands::Borderlands2::Daemon::Response
+D4v3::Borderlands::Borderlands2::Daemon::SaveCache::handle(const Request &request) noexcept(false) {
+    Response response;
+    if (request.type == RequestType::serial) {
+        Serial::DecodedSerial decoded;
+        if (!Serial::decodeSerial(request.payload, &decoded)) {
+            response.status = ResponseStatus::failed;
+            response.payload = "Invalid serial!";
+            return response;
+        }
+        response.payload = describeSerial(decoded);
+        return response;
+    }
+    if (request.type != RequestType::summary && request.type != RequestType::json &&
+        request.type != RequestType::verify) {
+        response.status = ResponseStatus::bad_request;
+        response.payload = "Unknown request type " + std::to_string((int) request.type) + "!";
+        return response;
+    }
+
+    std::shared_ptr<Entry> entry = load(request.payload);
+    if (!entry) {
+        response.status = ResponseStatus::failed;
+        response.payload = "Failed to read save " + request.payload + "!";
+        return response;
+    }
+    if (request.type == RequestType::summary) {
+        response.payload = entry->summary;
+    } else if (request.type == RequestType::json) {
+        if (entry->json.empty()) {
+            entry->json = Json::toJson(entry->save_game);
+        }
+        response.payload = entry->json;
+    }
+    return response;
+}
+
+std::shared_ptr<D4v3::Borderlands::Borderlands2::Daemon::SaveCache::Entry>
+D4v3::Borderlands::Borderlands2::Daemon::SaveCache::load(const std::string &path) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    boost::system::error_code error;
+    const uintmax_t file_size = boost::filesystem::file_size(path, error);
+    const std::time_t write_time = error ? 0 : boost::filesystem::last_write_time(path, error);
+    if (error) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+            << "Failed to stat " << path << "! " << error.message();
+        return nullptr;
+    }
+
+    auto cached = entries.find(path);
+    if (cached != entries.end()) {
+        recent.splice(recent.begin(), recent, cached->second.second);
+        const std::shared_ptr<Entry> &entry = cached->second.first;
+        if (entry->file_size == file_size && entry->write_time == write_time) {
+            ++hit_count;
+            return entry;
+        }
+        recent.erase(cached->second.second);
+        entries.erase(cached);
+    }
+
+    ++miss_count;
+    auto entry = std::make_shared<Entry>();
+    if (!readSave(path, &entry->save_game)) {
+        return nullptr;
+    }
+    entry->file_size = file_size;
+    entry->write_time = write_time;
+
+    const WillowTwoPlayerSaveGame &save_game = entry->save_game;
+    Missions::MissionIndex missions(mission_names);
+    missions.build(save_game);
+
+    std::ostringstream summary;
+    summary << "PlayerClass=" << save_game.playerclass() << "\n"
+            << "ExpLevel=" << save_game.explevel() << "\n"
+            << "ExpPoints=" << save_game.exppoints() << "\n"
+            << "PlaythroughsCompleted=" << save_game.playthroughscompleted() << "\n"
+            << "SaveGameId=" << save_game.savegameid() << "\n"
+            << "TotalPlayTime=" << save_game.totalplaytime() << "\n"
+            << "LastSavedDate=" << save_game.lastsaveddate() << "\n"
+            << "CompletedMissions=";
+    for (size_t playthrough = 0; playthrough < missions.playthroughCount(); ++playthrough) {
+        summary << (playthrough == 0 ? "" : ",") << missions.missions(playthrough, MissionStatus::Complete).count();
+    }
+    summary << "\n";
+    entry->summary = summary.str();
+
+    if (entries.size() >= capacity) {
+        entries.erase(recent.back());
+        recent.pop_back();
+    }
+    recent.push_front(path);
+    entries.emplace(path, std::make_pair(entry, recent.begin()));
+    return entry;
+}
+
+std::string D4v3::Borderlands::Borderlands2::Daemon::encodeFrame(uint8_t kind, const std::string &payload) noexcept(false) {
+    if (payload.size() >= max_frame_size) {
+        throw std::length_error("The payload exceeds the maximum frame size!");
+    }
+    const auto length = (uint32_t) (payload.size() + 1);
+
+    std::string frame;
+    frame.reserve(frame_header_size + payload.size());
+    for (int shift = 0; shift < 32; shift += 8) {
+        frame.push_back((char) ((length >> shift) & 0xFF));
+    }
+    frame.push_back((char) kind);
+    frame.append(payload);
+    return frame;
+}
+
+bool D4v3::Borderlands::Borderlands2::Daemon::decodeFrameHeader(const uint8_t *header, uint8_t *kind,
+                                                                 uint32_t *payload_size) noexcept(false) {
+    uint32_t length = 0;
+    for (int i = 0; i < 4; ++i) {
+        length |= (uint32_t) header[i] << (8 * i);
+    }
+    if (length == 0 || length > max_frame_size) {
+        return false;
+    }
+    *kind = header[4];
+    *payload_size = length - 1;
+    return true;
+}
+
+/*!
+ * @brief A connection of the server, reading a request and writing its response in turn.
+ */
+class Session : public std::enable_shared_from_this<Session> {
+public:
+    Session(stream_protocol::socket socket, const D4v3::Borderlands::Borderlands2::Daemon::RequestHandler &handler)
+            : socket(std::move(socket)), handler(handler), header() {
+    }
+
+    void start() {
+        readHeader();
+    }
+
+private:
+    void readHeader() {
+        auto self = shared_from_this();
+        boost::asio::async_read(socket, boost::asio::buffer(header),
+                                [self](const boost::system::error_code &error, size_t) {
+                                    if (!error) {
+                                        self->readPayload();
+                                    }
+                                });
+    }
+
+    void readPayload() {
+        uint8_t kind = 0;
+        uint32_t payload_size = 0;
+        if (!D4v3::Borderlands::Borderlands2::Daemon::decodeFrameHeader(header.data(), &kind, &payload_size)) {
+            boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+                << "Invalid frame header, closing the connection!";
+            return;
+        }
+        request.type = (D4v3::Borderlands::Borderlands2::Daemon::RequestType) kind;
+        request.payload.resize(payload_size);
+
+        auto self = shared_from_this();
+        boost::asio::async_read(socket, boost::asio::buffer(&request.payload[0], request.payload.size()),
+                                [self](const boost::system::error_code &error, size_t) {
+                                    if (!error) {
+                                        self->writeResponse();
+                                    }
+                                });
+    }
+
+    void writeResponse() {
+        // An exception escaping here would leave io_context.run and stop the server for all clients.
+        try {
+            D4v3::Borderlands::Borderlands2::Daemon::Response response = handler(request);
+            frame = D4v3::Borderlands::Borderlands2::Daemon::encodeFrame(response.status, response.payload);
+        } catch (std::exception &ex) {
+            boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to answer a request! " << ex.what();
+            frame = D4v3::Borderlands::Borderlands2::Daemon::encodeFrame(
+                    D4v3::Borderlands::Borderlands2::Daemon::ResponseStatus::failed,
+                    std::string("Failed to answer the request! ") + ex.what());
+        }
+
+        auto self = shared_from_this();
+        boost::asio::async_write(socket, boost::asio::buffer(frame),
+                                 [self](const boost::system::error_code &error, size_t) {
+                                     if (!error) {
+                                         self->readHeader();
+                                     }
+                                 });
+    }
+
+    stream_protocol::socket socket;
+    const D4v3::Borderlands::Borderlands2::Daemon::RequestHandler &handler;
+    std::array<uint8_t, D4v3::Borderlands::Borderlands2::Daemon::frame_header_size> header;
+    D4v3::Borderlands::Borderlands2::Daemon::Request request;
+    std::string frame;
+};
+
+struct D4v3::Borderlands::Borderlands2::Daemon::Server::Impl {
+    Impl(const std::string &socket_path, RequestHandler handler)
+            : socket_path(socket_path), handler(std::move(handler)), acceptor(io_context) {
+    }
+
+    void accept() {
+        acceptor.async_accept([this](const boost::system::error_code &error, stream_protocol::socket socket) {
+            if (error) {
+                return;
+            }
+            std::make_shared<Session>(std::move(socket), handler)->start();
+            accept();
+        });
+    }
+
+    std::string socket_path;
+    RequestHandler handler;
+    boost::asio::io_context io_context;
+    stream_protocol::acceptor acceptor;
+};
+
+D4v3::Borderlands::Borderlands2::Daemon::Server::Server(const std::string &socket_path, size_t capacity) noexcept(false)
+        : Server(socket_path, [cache = std::make_shared<SaveCache>(capacity)](const Request &request) {
+            return cache->handle(request);
+        }) {
+}
+
+D4v3::Borderlands::Borderlands2::Daemon::Server::Server(const std::string &socket_path,
+                                                         RequestHandler handler) noexcept(false)
+        : impl(new Impl(socket_path, std::move(handler))) {
+}
+
+D4v3::Borderlands::Borderlands2::Daemon::Server::~Server() {
+    if (impl->acceptor.is_open()) {
+        boost::system::error_code error;
+        impl->acceptor.close(error);
+        boost::filesystem::remove(impl->socket_path, error);
+    }
+}
+
+bool D4v3::Borderlands::Borderlands2::Daemon::Server::listen() noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    boost::system::error_code error;
+    // A socket file left behind by a previous server would make bind fail.
+    boost::filesystem::remove(impl->socket_path, error);
+
+    const stream_protocol::endpoint endpoint(impl->socket_path);
+    impl->acceptor.open(endpoint.protocol(), error);
+    if (!error) {
+        impl->acceptor.bind(endpoint, error);
+    }
+    // Connections are refused until listen is called, so no client can connect before the permissions are set.
+    if (!error) {
+        boost::filesystem::permissions(impl->socket_path,
+                                       boost::filesystem::owner_read | boost::filesystem::owner_write, error);
+    }
+    if (!error) {
+        impl->acceptor.listen(boost::asio::socket_base::max_listen_connections, error);
+    }
+    if (error) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to listen on " << impl->socket_path << "! " << error.message();
+        impl->acceptor.close(error);
+        return false;
+    }
+
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::info)
+        << "Listening on " << impl->socket_path;
+    impl->accept();
+    return true;
+}
+
+void D4v3::Borderlands::Borderlands2::Daemon::Server::run() noexcept(false) {
+    impl->io_context.run();
+}
+
+void D4v3::Borderlands::Borderlands2::Daemon::Server::stop() noexcept(false) {
+    impl->io_context.stop();
+}
+
+struct D4v3::Borderlands::Borderlands2::Daemon::Client::Impl {
+    explicit Impl(const std::string &socket_path)
+            : socket_path(socket_path), socket(io_context) {
+    }
+
+    std::string socket_path;
+    boost::asio::io_context io_context;
+    stream_protocol::socket socket;
+};
+
+D4v3::Borderlands::Borderlands2::Daemon::Client::Client(const std::string &socket_path) noexcept(false)
+        : impl(new Impl(socket_path)) {
+}
+
+D4v3::Borderlands::Borderlands2::Daemon::Client::~Client() = default;
+
+bool D4v3::Borderlands::Borderlands2::Daemon::Client::connect() noexcept(false) {
+    boost::system::error_code error;
+    impl->socket.connect(stream_protocol::endpoint(impl->socket_path), error);
+    if (error) {
+        boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to connect to " << impl->socket_path << "! " << error.message();
+        return false;
+    }
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::Daemon::Client::request(const Request &request,
+                                                              Response *response) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    boost::system::error_code error;
+    boost::asio::write(impl->socket, boost::asio::buffer(encodeFrame(request.type, request.payload)), error);
+
+    std::array<uint8_t, frame_header_size> header{};
+    if (!error) {
+        boost::asio::read(impl->socket, boost::asio::buffer(header), error);
+    }
+    if (error) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Request to " << impl->socket_path << " failed! " << error.message();
+        return false;
+    }
+
+    uint8_t kind = 0;
+    uint32_t payload_size = 0;
+    if (!decodeFrameHeader(header.data(), &kind, &payload_size)) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Invalid response frame from " << impl->socket_path << "!";
+        return false;
+    }
+    response->status = (ResponseStatus) kind;
+    response->payload.resize(payload_size);
+    if (payload_size > 0) {
+        boost::asio::read(impl->socket, boost::asio::buffer(&response->payload[0], payload_size), error);
+        if (error) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Request to " << impl->socket_path << " failed! " << error.message();
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,606 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/diff.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using google::protobuf::Descriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+/*!
+ * @brief Index of a path element for a field that does not exist in one of the saves.
+ */
+constexpr int32_t ABSENT = -2;
+
+/*!
+ * @brief Where the messages being compared are located in both saves.
+ */
+struct DiffLocation {
+    std::string path;
+    D4v3::Borderlands::Borderlands2::Edit::FieldPath old_path;
+    D4v3::Borderlands::Borderlands2::Edit::FieldPath new_path;
+};
+
+/*!
+ * @brief The fields identifying an element of a repeated message field.
+ *
+ * @return The numbers of the key fields, or nullptr if elements of the message are compared by index.
+ */
+const std::vector<int> *keyFields(const Descriptor *descriptor) {
+    static const std::unordered_map<std::string, std::vector<int>> key_fields = {
+            {BankSlot::descriptor()->full_name(),                   {1}},
+            {ChallengeData::descriptor()->full_name(),              {1}},
+            {ChosenVehicleCustomization::descriptor()->full_name(), {1}},
+            {DLCExpansionData::descriptor()->full_name(),           {1}},
+            {LockoutData::descriptor()->full_name(),                {1}},
+            {MissionData::descriptor()->full_name(),                {1}},
+            {MissionPlaythroughData::descriptor()->full_name(),     {1}},
+            {OneOffLevelChallengeData::descriptor()->full_name(),   {1, 2}},
+            {PackedItemData::descriptor()->full_name(),             {1}},
+            {PackedWeaponData::descriptor()->full_name(),           {1}},
+            {RegionGameStageData::descriptor()->full_name(),        {1, 5}},
+            {ResourceData::descriptor()->full_name(),               {1}},
+            {SkillData::descriptor()->full_name(),                  {1}},
+            {WorldDiscoveryData::descriptor()->full_name(),         {1}},
+    };
+
+    auto key = key_fields.find(descriptor->full_name());
+    return key != key_fields.end() ? &key->second : nullptr;
+}
+
+std::string toHex(const std::string &bytes) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (unsigned char byte : bytes) {
+        hex.push_back(digits[byte >> 4]);
+        hex.push_back(digits[byte & 0x0F]);
+    }
+    return hex;
+}
+
+std::string formatMessage(const Message &message);
+
+/*!
+ * @brief Formats a field, or an element of a repeated field if index is not -1.
+ *
+ * @details Strings are quoted, bytes are printed as hex and enums by name.
+ */
+std::string formatValue(const Message &message, const FieldDescriptor *field, int index) {
+    const Reflection *reflection = message.GetReflection();
+    const bool repeated = index >= 0;
+
+    std::ostringstream stream;
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            stream << (repeated ? reflection->GetRepeatedInt32(message, field, index) : reflection->GetInt32(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            stream << (repeated ? reflection->GetRepeatedInt64(message, field, index) : reflection->GetInt64(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            stream << (repeated ? reflection->GetRepeatedUInt32(message, field, index) : reflection->GetUInt32(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            stream << (repeated ? reflection->GetRepeatedUInt64(message, field, index) : reflection->GetUInt64(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            stream << ((repeated ? reflection->GetRepeatedBool(message, field, index) : reflection->GetBool(message, field)) ? "true" : "false");
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            stream << std::setprecision(std::numeric_limits<float>::max_digits10)
+                   << (repeated ? reflection->GetRepeatedFloat(message, field, index) : reflection->GetFloat(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            stream << std::setprecision(std::numeric_limits<double>::max_digits10)
+                   << (repeated ? reflection->GetRepeatedDouble(message, field, index) : reflection->GetDouble(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            stream << (repeated ? reflection->GetRepeatedEnum(message, field, index) : reflection->GetEnum(message, field))->name();
+            break;
+        case FieldDescriptor::CPPTYPE_STRING: {
+            const std::string value = repeated ? reflection->GetRepeatedString(message, field, index) : reflection->GetString(message, field);
+            if (field->type() == FieldDescriptor::TYPE_BYTES) {
+                stream << toHex(value);
+            } else {
+                stream << '"' << value << '"';
+            }
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            stream << formatMessage(repeated ? reflection->GetRepeatedMessage(message, field, index) : reflection->GetMessage(message, field));
+            break;
+    }
+    return stream.str();
+}
+
+/*!
+ * @brief Formats all set fields of a message on one line.
+ */
+std::string formatMessage(const Message &message) {
+    const Reflection *reflection = message.GetReflection();
+    std::vector<const FieldDescriptor *> fields;
+    reflection->ListFields(message, &fields);
+
+    std::string text = "{";
+    for (size_t i = 0; i < fields.size(); ++i) {
+        const FieldDescriptor *field = fields[i];
+        text += (i == 0 ? "" : ", ") + field->name() + ": ";
+        if (field->is_repeated()) {
+            text += "[";
+            for (int index = 0; index < reflection->FieldSize(message, field); ++index) {
+                text += (index == 0 ? "" : ", ") + formatValue(message, field, index);
+            }
+            text += "]";
+        } else {
+            text += formatValue(message, field, -1);
+        }
+    }
+    return text + "}";
+}
+
+/*!
+ * @brief Compares two scalar values of the same field.
+ */
+bool equalValues(const Message &old_message, int old_index, const Message &new_message, int new_index,
+                 const FieldDescriptor *field) {
+    const Reflection *reflection = old_message.GetReflection();
+    const bool repeated = field->is_repeated();
+
+#define BL2_DIFF_COMPARE(TYPE)                                                                  \
+    return repeated ? reflection->GetRepeated##TYPE(old_message, field, old_index) ==           \
+                              reflection->GetRepeated##TYPE(new_message, field, new_index)      \
+                    : reflection->Get##TYPE(old_message, field) == reflection->Get##TYPE(new_message, field)
+
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            BL2_DIFF_COMPARE(Int32);
+        case FieldDescriptor::CPPTYPE_INT64:
+            BL2_DIFF_COMPARE(Int64);
+        case FieldDescriptor::CPPTYPE_UINT32:
+            BL2_DIFF_COMPARE(UInt32);
+        case FieldDescriptor::CPPTYPE_UINT64:
+            BL2_DIFF_COMPARE(UInt64);
+        case FieldDescriptor::CPPTYPE_BOOL:
+            BL2_DIFF_COMPARE(Bool);
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            BL2_DIFF_COMPARE(Float);
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            BL2_DIFF_COMPARE(Double);
+        case FieldDescriptor::CPPTYPE_ENUM:
+            BL2_DIFF_COMPARE(EnumValue);
+        case FieldDescriptor::CPPTYPE_STRING:
+            BL2_DIFF_COMPARE(String);
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            break;
+    }
+#undef BL2_DIFF_COMPARE
+    return false;
+}
+
+/*!
+ * @brief Formats a value as part of a key, strings are not quoted.
+ */
+std::string keyValue(const Message &message, const FieldDescriptor *field, int index) {
+    if (field->type() == FieldDescriptor::TYPE_STRING) {
+        const Reflection *reflection = message.GetReflection();
+        return index >= 0 ? reflection->GetRepeatedString(message, field, index) : reflection->GetString(message, field);
+    }
+    return formatValue(message, field, index);
+}
+
+/*!
+ * @brief Builds the key of an element of a repeated field.
+ *
+ * @return true if the field is aligned by key, false if it is aligned by index.
+ */
+bool elementKey(const Message &message, const FieldDescriptor *field, int index, std::string *key) {
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+        *key = keyValue(message, field, index);
+        return true;
+    }
+    if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+        return false;
+    }
+
+    const std::vector<int> *key_fields = keyFields(field->message_type());
+    if (key_fields == nullptr) {
+        return false;
+    }
+
+    const Message &element = message.GetReflection()->GetRepeatedMessage(message, field, index);
+    key->clear();
+    for (int number : *key_fields) {
+        *key += (key->empty() ? "" : ",") + keyValue(element, element.GetDescriptor()->FindFieldByNumber(number), -1);
+    }
+    return true;
+}
+
+DiffLocation childLocation(const DiffLocation &parent, const std::string &name, int32_t number,
+                           int32_t old_index, int32_t new_index) {
+    DiffLocation location;
+    location.path = parent.path.empty() ? name : parent.path + "." + name;
+    if (old_index != ABSENT) {
+        location.old_path = parent.old_path;
+        location.old_path.push_back({number, old_index});
+    }
+    if (new_index != ABSENT) {
+        location.new_path = parent.new_path;
+        location.new_path.push_back({number, new_index});
+    }
+    return location;
+}
+
+void addChange(D4v3::Borderlands::Borderlands2::Diff::ChangeKind kind, DiffLocation location,
+               std::string old_value, std::string new_value,
+               std::vector<D4v3::Borderlands::Borderlands2::Diff::Change> *changes) {
+    D4v3::Borderlands::Borderlands2::Diff::Change change;
+    change.kind = kind;
+    change.path = std::move(location.path);
+    change.old_path = std::move(location.old_path);
+    change.new_path = std::move(location.new_path);
+    change.old_value = std::move(old_value);
+    change.new_value = std::move(new_value);
+    changes->push_back(std::move(change));
+}
+
+void diffMessages(const Message &old_message, const Message &new_message, const DiffLocation &location,
+                  std::vector<D4v3::Borderlands::Borderlands2::Diff::Change> *changes);
+
+/*!
+ * @brief Compares two elements of a repeated field that were aligned with each other.
+ */
+void diffElements(const Message &old_message, int old_index, const Message &new_message, int new_index,
+                  const FieldDescriptor *field, const DiffLocation &location,
+                  std::vector<D4v3::Borderlands::Borderlands2::Diff::Change> *changes) {
+    const Reflection *reflection = old_message.GetReflection();
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        diffMessages(reflection->GetRepeatedMessage(old_message, field, old_index),
+                     reflection->GetRepeatedMessage(new_message, field, new_index), location, changes);
+    } else if (!equalValues(old_message, old_index, new_message, new_index, field)) {
+        addChange(D4v3::Borderlands::Borderlands2::Diff::ChangeKind::changed, location,
+                  formatValue(old_message, field, old_index), formatValue(new_message, field, new_index), changes);
+    }
+}
+
+/*!
+ * @brief Alignment of the elements of a repeated field by key.
+ */
+struct ElementMatch {
+    /*!
+     * @brief The index of the matching new element for every old element, -1 for removed elements.
+     */
+    std::vector<int> old_to_new;
+
+    /*!
+     * @brief If a new element has a matching old element.
+     */
+    std::vector<bool> new_matched;
+
+    /*!
+     * @brief The keys of the old elements, repeated keys get the number of the occurrence appended.
+     */
+    std::vector<std::string> old_names;
+
+    /*!
+     * @brief The keys of the new elements, repeated keys get the number of the occurrence appended.
+     */
+    std::vector<std::string> new_names;
+};
+
+/*!
+ * @brief Aligns the elements of a repeated field by key.
+ *
+ * @details Elements sharing a key, as copies of an item, are matched in the order they appear in.
+ *
+ * @return true if the field has keys, false if it has to be aligned by index.
+ */
+bool matchElements(const Message &old_message, const Message &new_message, const FieldDescriptor *field,
+                   ElementMatch *match) {
+    const Reflection *reflection = old_message.GetReflection();
+    const int old_size = reflection->FieldSize(old_message, field);
+    const int new_size = reflection->FieldSize(new_message, field);
+
+    std::string key;
+    if (old_size + new_size == 0 || !elementKey(old_size > 0 ? old_message : new_message, field, 0, &key)) {
+        return false;
+    }
+
+    struct KeyedElements {
+        std::vector<int> indices;
+        size_t matched = 0;
+    };
+    std::unordered_map<std::string, KeyedElements> new_elements;
+    new_elements.reserve((size_t) new_size);
+    match->new_names.resize((size_t) new_size);
+    for (int j = 0; j < new_size; ++j) {
+        elementKey(new_message, field, j, &key);
+        std::vector<int> &indices = new_elements[key].indices;
+        match->new_names[j] = indices.empty() ? key : key + "#" + std::to_string(indices.size());
+        indices.push_back(j);
+    }
+
+    match->old_to_new.assign((size_t) old_size, -1);
+    match->new_matched.assign((size_t) new_size, false);
+    match->old_names.resize((size_t) old_size);
+    std::unordered_map<std::string, int> old_occurrences;
+    for (int i = 0; i < old_size; ++i) {
+        elementKey(old_message, field, i, &key);
+        const int occurrence = old_occurrences[key]++;
+        match->old_names[i] = occurrence == 0 ? key : key + "#" + std::to_string(occurrence);
+
+        auto elements = new_elements.find(key);
+        if (elements != new_elements.end() && elements->second.matched < elements->second.indices.size()) {
+            const int j = elements->second.indices[elements->second.matched++];
+            match->old_to_new[i] = j;
+            match->new_matched[j] = true;
+        }
+    }
+    return true;
+}
+
+void diffRepeated(const Message &old_message, const Message &new_message, const FieldDescriptor *field,
+                  const DiffLocation &location, std::vector<D4v3::Borderlands::Borderlands2::Diff::Change> *changes) {
+    using D4v3::Borderlands::Borderlands2::Diff::ChangeKind;
+
+    const Reflection *reflection = old_message.GetReflection();
+    const int old_size = reflection->FieldSize(old_message, field);
+    const int new_size = reflection->FieldSize(new_message, field);
+    const std::string name = field->name();
+    const int32_t number = field->number();
+
+    ElementMatch match;
+    if (!matchElements(old_message, new_message, field, &match)) {
+        for (int i = 0; i < std::max(old_size, new_size); ++i) {
+            const std::string element = name + "[" + std::to_string(i) + "]";
+            if (i >= new_size) {
+                addChange(ChangeKind::removed, childLocation(location, element, number, i, ABSENT),
+                          formatValue(old_message, field, i), "", changes);
+            } else if (i >= old_size) {
+                addChange(ChangeKind::added, childLocation(location, element, number, ABSENT, i),
+                          "", formatValue(new_message, field, i), changes);
+            } else {
+                diffElements(old_message, i, new_message, i, field, childLocation(location, element, number, i, i),
+                             changes);
+            }
+        }
+        return;
+    }
+
+    for (int i = 0; i < old_size; ++i) {
+        const std::string element = name + "[" + match.old_names[i] + "]";
+        const int j = match.old_to_new[i];
+        if (j < 0) {
+            addChange(ChangeKind::removed, childLocation(location, element, number, i, ABSENT),
+                      formatValue(old_message, field, i), "", changes);
+        } else {
+            diffElements(old_message, i, new_message, j, field, childLocation(location, element, number, i, j), changes);
+        }
+    }
+
+    for (int j = 0; j < new_size; ++j) {
+        if (!match.new_matched[j]) {
+            addChange(ChangeKind::added, childLocation(location, name + "[" + match.new_names[j] + "]", number, ABSENT, j),
+                      "", formatValue(new_message, field, j), changes);
+        }
+    }
+}
+
+void diffMessages(const Message &old_message, const Message &new_message, const DiffLocation &location,
+                  std::vector<D4v3::Borderlands::Borderlands2::Diff::Change> *changes) {
+    using D4v3::Borderlands::Borderlands2::Diff::ChangeKind;
+
+    const Descriptor *descriptor = old_message.GetDescriptor();
+    const Reflection *reflection = old_message.GetReflection();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+        const FieldDescriptor *field = descriptor->field(i);
+        if (field->is_repeated()) {
+            diffRepeated(old_message, new_message, field, location, changes);
+            continue;
+        }
+
+        const bool old_present = reflection->HasField(old_message, field);
+        const bool new_present = reflection->HasField(new_message, field);
+        if (!old_present && !new_present) {
+            continue;
+        }
+
+        if (!new_present) {
+            addChange(ChangeKind::removed, childLocation(location, field->name(), field->number(), -1, ABSENT),
+                      formatValue(old_message, field, -1), "", changes);
+        } else if (!old_present) {
+            addChange(ChangeKind::added, childLocation(location, field->name(), field->number(), ABSENT, -1),
+                      "", formatValue(new_message, field, -1), changes);
+        } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+            diffMessages(reflection->GetMessage(old_message, field), reflection->GetMessage(new_message, field),
+                         childLocation(location, field->name(), field->number(), -1, -1), changes);
+        } else if (!equalValues(old_message, -1, new_message, -1, field)) {
+            addChange(ChangeKind::changed, childLocation(location, field->name(), field->number(), -1, -1),
+                      formatValue(old_message, field, -1), formatValue(new_message, field, -1), changes);
+        }
+    }
+}
+
+/*!
+ * @brief The saves edits are built for, the values of the edits are read from them.
+ */
+struct EditContext {
+    const WillowTwoPlayerSaveGame &old_save;
+    const WillowTwoPlayerSaveGame &new_save;
+    std::vector<D4v3::Borderlands::Borderlands2::Edit::FieldEdit> *edits;
+};
+
+D4v3::Borderlands::Borderlands2::Edit::FieldPath appendPath(D4v3::Borderlands::Borderlands2::Edit::FieldPath path,
+                                                           int32_t number, int32_t index) {
+    path.push_back({number, index});
+    return path;
+}
+
+/*!
+ * @brief Adds an edit, the old value is read at old_path and the new value at new_path if given.
+ *
+ * @param[in] path The path of the edited field at the time the edit is applied.
+ */
+void addEdit(const EditContext &context, D4v3::Borderlands::Borderlands2::Edit::Operation operation,
+             D4v3::Borderlands::Borderlands2::Edit::FieldPath path,
+             const D4v3::Borderlands::Borderlands2::Edit::FieldPath *old_path,
+             const D4v3::Borderlands::Borderlands2::Edit::FieldPath *new_path) {
+    D4v3::Borderlands::Borderlands2::Edit::FieldEdit edit;
+    edit.path = std::move(path);
+    edit.operation = operation;
+    if (old_path != nullptr) {
+        D4v3::Borderlands::Borderlands2::Edit::readValue(context.old_save, *old_path, &edit.old_value);
+    }
+    if (new_path != nullptr) {
+        D4v3::Borderlands::Borderlands2::Edit::readValue(context.new_save, *new_path, &edit.new_value);
+    }
+    context.edits->push_back(std::move(edit));
+}
+
+void collectEdits(const Message &old_message, const Message &new_message, const DiffLocation &location,
+                  const EditContext &context);
+
+/*!
+ * @brief Adds the edits of two aligned elements, the element is at new_index when the edits are applied.
+ */
+void collectElementEdits(const Message &old_message, int old_index, const Message &new_message, int new_index,
+                         const FieldDescriptor *field, const DiffLocation &location, const EditContext &context) {
+    const Reflection *reflection = old_message.GetReflection();
+    const DiffLocation element = childLocation(location, "", field->number(), old_index, new_index);
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        collectEdits(reflection->GetRepeatedMessage(old_message, field, old_index),
+                     reflection->GetRepeatedMessage(new_message, field, new_index), element, context);
+    } else if (!equalValues(old_message, old_index, new_message, new_index, field)) {
+        addEdit(context, D4v3::Borderlands::Borderlands2::Edit::Operation::set, element.new_path,
+                &element.old_path, &element.new_path);
+    }
+}
+
+void collectRepeatedEdits(const Message &old_message, const Message &new_message, const FieldDescriptor *field,
+                          const DiffLocation &location, const EditContext &context) {
+    using D4v3::Borderlands::Borderlands2::Edit::Operation;
+
+    const Reflection *reflection = old_message.GetReflection();
+    const int old_size = reflection->FieldSize(old_message, field);
+    const int new_size = reflection->FieldSize(new_message, field);
+    const int32_t number = field->number();
+
+    ElementMatch match;
+    bool keyed = matchElements(old_message, new_message, field, &match);
+    for (int i = 0, last = -1; keyed && i < old_size; ++i) {
+        if (match.old_to_new[i] >= 0) {
+            keyed = match.old_to_new[i] > last;
+            last = match.old_to_new[i];
+        }
+    }
+
+    if (!keyed) {
+        for (int i = 0; i < std::min(old_size, new_size); ++i) {
+            collectElementEdits(old_message, i, new_message, i, field, location, context);
+        }
+        for (int i = old_size - 1; i >= new_size; --i) {
+            const auto old_path = appendPath(location.old_path, number, i);
+            addEdit(context, Operation::remove, appendPath(location.new_path, number, i), &old_path, nullptr);
+        }
+        for (int j = old_size; j < new_size; ++j) {
+            const auto new_path = appendPath(location.new_path, number, j);
+            addEdit(context, Operation::insert, new_path, nullptr, &new_path);
+        }
+        return;
+    }
+
+    // Removing from the back keeps the indices of the remaining old elements, inserting from the front puts
+    // every element at its new index, as the matched elements kept their order.
+    for (int i = old_size - 1; i >= 0; --i) {
+        if (match.old_to_new[i] < 0) {
+            const auto old_path = appendPath(location.old_path, number, i);
+            addEdit(context, Operation::remove, appendPath(location.new_path, number, i), &old_path, nullptr);
+        }
+    }
+    for (int j = 0; j < new_size; ++j) {
+        if (!match.new_matched[j]) {
+            const auto new_path = appendPath(location.new_path, number, j);
+            addEdit(context, Operation::insert, new_path, nullptr, &new_path);
+        }
+    }
+    for (int i = 0; i < old_size; ++i) {
+        if (match.old_to_new[i] >= 0) {
+            collectElementEdits(old_message, i, new_message, match.old_to_new[i], field, location, context);
+        }
+    }
+}
+
+void collectEdits(const Message &old_message, const Message &new_message, const DiffLocation &location,
+                  const EditContext &context) {
+    const Descriptor *descriptor = old_message.GetDescriptor();
+    const Reflection *reflection = old_message.GetReflection();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+        const FieldDescriptor *field = descriptor->field(i);
+        if (field->is_repeated()) {
+            collectRepeatedEdits(old_message, new_message, field, location, context);
+            continue;
+        }
+
+        const bool old_present = reflection->HasField(old_message, field);
+        const bool new_present = reflection->HasField(new_message, field);
+        if (!old_present && !new_present) {
+            continue;
+        }
+
+        const DiffLocation child = childLocation(location, "", field->number(), -1, -1);
+        if (old_present && new_present) {
+            if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+                collectEdits(reflection->GetMessage(old_message, field), reflection->GetMessage(new_message, field),
+                             child, context);
+                continue;
+            }
+            if (equalValues(old_message, -1, new_message, -1, field)) {
+                continue;
+            }
+        }
+        addEdit(context, D4v3::Borderlands::Borderlands2::Edit::Operation::set, child.new_path,
+                &child.old_path, &child.new_path);
+    }
+}
+
+void D4v3::Borderlands::Borderlands2::Diff::diffSaves(const WillowTwoPlayerSaveGame &old_save,
+                                                      const WillowTwoPlayerSaveGame &new_save,
+                                                      std::vector<Change> *changes) noexcept(false) {
+    changes->clear();
+    diffMessages(old_save, new_save, DiffLocation(), changes);
+}
+
+void D4v3::Borderlands::Borderlands2::Diff::diffEdits(const WillowTwoPlayerSaveGame &old_save,
+                                                      const WillowTwoPlayerSaveGame &new_save,
+                                                      std::vector<Edit::FieldEdit> *edits) noexcept(false) {
+    edits->clear();
+    collectEdits(old_save, new_save, DiffLocation(), EditContext{old_save, new_save, edits});
+}
+
+std::string D4v3::Borderlands::Borderlands2::Diff::formatChanges(const std::vector<Change> &changes) noexcept(false) {
+    std::string text;
+    for (const Change &change : changes) {
+        switch (change.kind) {
+            case ChangeKind::added:
+                text += "+ " + change.path + ": " + change.new_value + "\n";
+                break;
+            case ChangeKind::removed:
+                text += "- " + change.path + ": " + change.old_value + "\n";
+                break;
+            case ChangeKind::changed:
+                text += "~ " + change.path + ": " + change.old_value + " -> " + change.new_value + "\n";
+                break;
+        }
+    }
+    return text;
+}
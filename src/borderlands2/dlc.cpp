@@ -0,0 +1,70 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/dlc.hpp"
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+bool D4v3::Borderlands::Borderlands2::Dlc::ExpansionDecoders::knows(int32_t tag) const noexcept(false) {
+    return decoders.find(tag) != decoders.end();
+}
+
+D4v3::Borderlands::Borderlands2::Dlc::Expansions::Expansions(std::shared_ptr<const WillowTwoPlayerSaveGame> save_game,
+                                                             std::shared_ptr<const ExpansionDecoders> decoders) noexcept(false)
+        : save_game(std::move(save_game)), decoders(std::move(decoders)) {
+}
+
+std::vector<int32_t> D4v3::Borderlands::Borderlands2::Dlc::Expansions::tags() const noexcept(false) {
+    std::vector<int32_t> result;
+    for (const DLCExpansionData &expansion : save_game->dlcexpansiondata()) {
+        result.push_back(expansion.tag());
+    }
+    return result;
+}
+
+const std::string *D4v3::Borderlands::Borderlands2::Dlc::Expansions::data(int32_t tag) const noexcept(false) {
+    for (const DLCExpansionData &expansion : save_game->dlcexpansiondata()) {
+        if (expansion.tag() == tag) {
+            return &expansion.data();
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const void>
+D4v3::Borderlands::Borderlands2::Dlc::Expansions::decode(int32_t tag, std::type_index type) const noexcept(false) {
+    auto decoder = decoders->decoders.find(tag);
+    if (decoder == decoders->decoders.end() || decoder->second.type != type) {
+        return nullptr;
+    }
+
+    const std::string *expansion_data = data(tag);
+    if (expansion_data == nullptr) {
+        decoded.erase(tag);
+        return nullptr;
+    }
+
+    // The result is only used while the save still holds the bytes it was decoded from.
+    auto cached = decoded.find(tag);
+    if (cached != decoded.end() && cached->second.data == *expansion_data) {
+        return cached->second.result;
+    }
+
+    std::shared_ptr<const void> result = decoder->second.decode(*expansion_data);
+    if (!result) {
+        boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+            << "Failed to decode the expansion data of tag " << tag << "!";
+    }
+    decoded[tag] = Decoded{*expansion_data, result};
+    return result;
+}
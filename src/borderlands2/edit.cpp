@@ -0,0 +1,447 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/edit.hpp"
+#include "borderlands2/borderlands2.hpp"
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+/*!
+ * @brief Follows all but the last element of a path.
+ *
+ * @param[in] root The message the path starts at.
+ * @param[in] path The path to follow.
+ * @param[out] field The field the last element of the path refers to.
+ * @return The message holding field, or nullptr if the path does not exist.
+ */
+Message *resolveParent(Message *root, const D4v3::Borderlands::Borderlands2::Edit::FieldPath &path,
+                       const FieldDescriptor **field) {
+    if (path.empty()) {
+        return nullptr;
+    }
+
+    Message *message = root;
+    for (size_t i = 0; i < path.size(); ++i) {
+        const FieldDescriptor *current = message->GetDescriptor()->FindFieldByNumber(path[i].field_number);
+        if (current == nullptr) {
+            return nullptr;
+        }
+
+        if (i + 1 == path.size()) {
+            *field = current;
+            return message;
+        }
+
+        if (current->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+            return nullptr;
+        }
+
+        const Reflection *reflection = message->GetReflection();
+        if (current->is_repeated()) {
+            if (path[i].index < 0 || path[i].index >= reflection->FieldSize(*message, current)) {
+                return nullptr;
+            }
+            message = reflection->MutableRepeatedMessage(message, current, path[i].index);
+        } else {
+            message = reflection->MutableMessage(message, current);
+        }
+    }
+    return nullptr;
+}
+
+/*!
+ * @brief Follows all but the last element of a path without modifying the message.
+ *
+ * @details Singular message fields that are not set resolve to their default instance.
+ */
+const Message *resolveParent(const Message &root, const D4v3::Borderlands::Borderlands2::Edit::FieldPath &path,
+                             const FieldDescriptor **field) {
+    if (path.empty()) {
+        return nullptr;
+    }
+
+    const Message *message = &root;
+    for (size_t i = 0; i < path.size(); ++i) {
+        const FieldDescriptor *current = message->GetDescriptor()->FindFieldByNumber(path[i].field_number);
+        if (current == nullptr) {
+            return nullptr;
+        }
+
+        if (i + 1 == path.size()) {
+            *field = current;
+            return message;
+        }
+
+        if (current->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+            return nullptr;
+        }
+
+        const Reflection *reflection = message->GetReflection();
+        if (current->is_repeated()) {
+            if (path[i].index < 0 || path[i].index >= reflection->FieldSize(*message, current)) {
+                return nullptr;
+            }
+            message = &reflection->GetRepeatedMessage(*message, current, path[i].index);
+        } else {
+            message = &reflection->GetMessage(*message, current);
+        }
+    }
+    return nullptr;
+}
+
+/*!
+ * @brief Checks that the index of the last path element fits the field.
+ *
+ * @param[in] size The number of elements of a repeated field.
+ * @param[in] index The index of the element.
+ * @param[in] end_allowed If the index behind the last element is valid, as for inserts.
+ */
+bool validIndex(const FieldDescriptor *field, int size, int32_t index, bool end_allowed) {
+    if (!field->is_repeated()) {
+        return index == -1 && !end_allowed;
+    }
+    return index >= 0 && (index < size || (end_allowed && index == size));
+}
+
+D4v3::Borderlands::Borderlands2::Edit::FieldValue readFieldValue(const Message &message, const FieldDescriptor *field,
+                                                                 int32_t index) {
+    const Reflection *reflection = message.GetReflection();
+    const bool repeated = field->is_repeated();
+
+    D4v3::Borderlands::Borderlands2::Edit::FieldValue value;
+    value.present = repeated || reflection->HasField(message, field);
+
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            value.integer = repeated ? reflection->GetRepeatedInt32(message, field, index) : reflection->GetInt32(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            value.integer = repeated ? reflection->GetRepeatedInt64(message, field, index) : reflection->GetInt64(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            value.integer = repeated ? reflection->GetRepeatedUInt32(message, field, index) : reflection->GetUInt32(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            value.integer = (int64_t) (repeated ? reflection->GetRepeatedUInt64(message, field, index) : reflection->GetUInt64(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            value.integer = repeated ? reflection->GetRepeatedBool(message, field, index) : reflection->GetBool(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            value.integer = repeated ? reflection->GetRepeatedEnum(message, field, index)->number() : reflection->GetEnum(message, field)->number();
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            value.floating = repeated ? reflection->GetRepeatedFloat(message, field, index) : reflection->GetFloat(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            value.floating = repeated ? reflection->GetRepeatedDouble(message, field, index) : reflection->GetDouble(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_STRING:
+            value.bytes = repeated ? reflection->GetRepeatedString(message, field, index) : reflection->GetString(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            value.bytes = (repeated ? reflection->GetRepeatedMessage(message, field, index) : reflection->GetMessage(message, field)).SerializePartialAsString();
+            break;
+    }
+    return value;
+}
+
+/*!
+ * @brief Stores a value in a singular field or an existing element of a repeated field.
+ */
+bool writeFieldValue(Message *message, const FieldDescriptor *field, int32_t index,
+                     const D4v3::Borderlands::Borderlands2::Edit::FieldValue &value) {
+    const Reflection *reflection = message->GetReflection();
+    const bool repeated = field->is_repeated();
+
+    if (!repeated && !value.present) {
+        reflection->ClearField(message, field);
+        return true;
+    }
+
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            repeated ? reflection->SetRepeatedInt32(message, field, index, (int32_t) value.integer) : reflection->SetInt32(message, field, (int32_t) value.integer);
+            return true;
+        case FieldDescriptor::CPPTYPE_INT64:
+            repeated ? reflection->SetRepeatedInt64(message, field, index, value.integer) : reflection->SetInt64(message, field, value.integer);
+            return true;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            repeated ? reflection->SetRepeatedUInt32(message, field, index, (uint32_t) value.integer) : reflection->SetUInt32(message, field, (uint32_t) value.integer);
+            return true;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            repeated ? reflection->SetRepeatedUInt64(message, field, index, (uint64_t) value.integer) : reflection->SetUInt64(message, field, (uint64_t) value.integer);
+            return true;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            repeated ? reflection->SetRepeatedBool(message, field, index, value.integer != 0) : reflection->SetBool(message, field, value.integer != 0);
+            return true;
+        case FieldDescriptor::CPPTYPE_ENUM: {
+            const google::protobuf::EnumValueDescriptor *enum_value = field->enum_type()->FindValueByNumber((int) value.integer);
+            if (enum_value == nullptr) {
+                return false;
+            }
+            repeated ? reflection->SetRepeatedEnum(message, field, index, enum_value) : reflection->SetEnum(message, field, enum_value);
+            return true;
+        }
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            repeated ? reflection->SetRepeatedFloat(message, field, index, (float) value.floating) : reflection->SetFloat(message, field, (float) value.floating);
+            return true;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            repeated ? reflection->SetRepeatedDouble(message, field, index, value.floating) : reflection->SetDouble(message, field, value.floating);
+            return true;
+        case FieldDescriptor::CPPTYPE_STRING:
+            repeated ? reflection->SetRepeatedString(message, field, index, value.bytes) : reflection->SetString(message, field, value.bytes);
+            return true;
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            return (repeated ? reflection->MutableRepeatedMessage(message, field, index) : reflection->MutableMessage(message, field))->ParsePartialFromString(value.bytes);
+    }
+    return false;
+}
+
+/*!
+ * @brief Inserts a value into a repeated field before index.
+ *
+ * @details The value is appended and moved to its position with swaps of the element pointers, one per element
+ *  behind index. Repeated fields are arrays, so an insert has to move them, an append costs no swap.
+ */
+bool insertFieldValue(Message *message, const FieldDescriptor *field, int32_t index,
+                      const D4v3::Borderlands::Borderlands2::Edit::FieldValue &value) {
+    const Reflection *reflection = message->GetReflection();
+
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            reflection->AddInt32(message, field, (int32_t) value.integer);
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            reflection->AddInt64(message, field, value.integer);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            reflection->AddUInt32(message, field, (uint32_t) value.integer);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            reflection->AddUInt64(message, field, (uint64_t) value.integer);
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            reflection->AddBool(message, field, value.integer != 0);
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM: {
+            const google::protobuf::EnumValueDescriptor *enum_value = field->enum_type()->FindValueByNumber((int) value.integer);
+            if (enum_value == nullptr) {
+                return false;
+            }
+            reflection->AddEnum(message, field, enum_value);
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            reflection->AddFloat(message, field, (float) value.floating);
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            reflection->AddDouble(message, field, value.floating);
+            break;
+        case FieldDescriptor::CPPTYPE_STRING:
+            reflection->AddString(message, field, value.bytes);
+            break;
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            if (!reflection->AddMessage(message, field)->ParsePartialFromString(value.bytes)) {
+                reflection->RemoveLast(message, field);
+                return false;
+            }
+            break;
+    }
+
+    for (int i = reflection->FieldSize(*message, field) - 1; i > index; --i) {
+        reflection->SwapElements(message, field, i, i - 1);
+    }
+    return true;
+}
+
+/*!
+ * @brief Removes the element at index from a repeated field.
+ *
+ * @details The element is moved to the end with one swap per element behind it and removed there.
+ */
+void removeFieldValue(Message *message, const FieldDescriptor *field, int32_t index) {
+    const Reflection *reflection = message->GetReflection();
+    for (int i = index; i + 1 < reflection->FieldSize(*message, field); ++i) {
+        reflection->SwapElements(message, field, i, i + 1);
+    }
+    reflection->RemoveLast(message, field);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Edit::readValue(const WillowTwoPlayerSaveGame &save_game, const FieldPath &path,
+                                                 FieldValue *value) noexcept(false) {
+    const FieldDescriptor *field = nullptr;
+    const Message *message = resolveParent(save_game, path, &field);
+    if (message == nullptr) {
+        return false;
+    }
+
+    const int32_t index = path.back().index;
+    if (!validIndex(field, field->is_repeated() ? message->GetReflection()->FieldSize(*message, field) : 0, index, false)) {
+        return false;
+    }
+
+    *value = readFieldValue(*message, field, index);
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Edit::applyEdit(const FieldEdit &edit, WillowTwoPlayerSaveGame *save_game,
+                                                 bool reverse) noexcept(false) {
+    const FieldDescriptor *field = nullptr;
+    Message *message = resolveParent(save_game, edit.path, &field);
+    if (message == nullptr) {
+        return false;
+    }
+
+    const int32_t index = edit.path.back().index;
+    const int size = field->is_repeated() ? message->GetReflection()->FieldSize(*message, field) : 0;
+
+    // Reverting an insert removes the element and reverting a remove inserts it again.
+    bool inserting = (edit.operation == Operation::insert && !reverse) || (edit.operation == Operation::remove && reverse);
+    bool removing = (edit.operation == Operation::remove && !reverse) || (edit.operation == Operation::insert && reverse);
+
+    if (inserting) {
+        return validIndex(field, size, index, true) &&
+               insertFieldValue(message, field, index, reverse ? edit.old_value : edit.new_value);
+    }
+
+    if (!validIndex(field, size, index, false)) {
+        return false;
+    }
+
+    if (removing) {
+        if (!field->is_repeated()) {
+            return false;
+        }
+        removeFieldValue(message, field, index);
+        return true;
+    }
+
+    return writeFieldValue(message, field, index, reverse ? edit.old_value : edit.new_value);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Edit::applyEdits(const std::vector<FieldEdit> &edits,
+                                                  WillowTwoPlayerSaveGame *save_game) noexcept(false) {
+    for (const FieldEdit &edit : edits) {
+        if (!applyEdit(edit, save_game)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Edit::replaySave(const std::string &original_path, const std::vector<FieldEdit> &edits,
+                                                  const std::string &path,
+                                                  Common::Streams::Endian endianess) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    WillowTwoPlayerSaveGame save_game;
+    if (!readSave(original_path, &save_game)) {
+        return false;
+    }
+
+    if (!applyEdits(edits, &save_game)) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Edits do not apply to the save: " << original_path;
+        return false;
+    }
+
+    return writeSave(save_game, path, endianess);
+}
+
+D4v3::Borderlands::Borderlands2::Edit::EditHistory::EditHistory(WillowTwoPlayerSaveGame *save_game) noexcept
+        : save_game(save_game) {
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::set(const FieldPath &path,
+                                                             const FieldValue &value) noexcept(false) {
+    FieldEdit edit;
+    edit.path = path;
+    edit.operation = Operation::set;
+    edit.new_value = value;
+    if (!readValue(*save_game, path, &edit.old_value)) {
+        return false;
+    }
+    return apply(std::move(edit));
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::insert(const FieldPath &path,
+                                                                const FieldValue &value) noexcept(false) {
+    FieldEdit edit;
+    edit.path = path;
+    edit.operation = Operation::insert;
+    edit.new_value = value;
+    return apply(std::move(edit));
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::remove(const FieldPath &path) noexcept(false) {
+    FieldEdit edit;
+    edit.path = path;
+    edit.operation = Operation::remove;
+    if (!readValue(*save_game, path, &edit.old_value)) {
+        return false;
+    }
+    return apply(std::move(edit));
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::apply(FieldEdit edit) noexcept(false) {
+    if (!applyEdit(edit, save_game)) {
+        return false;
+    }
+    undo_stack.push_back(std::move(edit));
+    redo_stack.clear();
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::canUndo() const noexcept {
+    return !undo_stack.empty();
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::canRedo() const noexcept {
+    return !redo_stack.empty();
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::undo() noexcept(false) {
+    if (undo_stack.empty() || !applyEdit(undo_stack.back(), save_game, true)) {
+        return false;
+    }
+    redo_stack.push_back(std::move(undo_stack.back()));
+    undo_stack.pop_back();
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::Edit::EditHistory::redo() noexcept(false) {
+    if (redo_stack.empty() || !applyEdit(redo_stack.back(), save_game)) {
+        return false;
+    }
+    undo_stack.push_back(std::move(redo_stack.back()));
+    redo_stack.pop_back();
+    return true;
+}
+
+const std::vector<D4v3::Borderlands::Borderlands2::Edit::FieldEdit> &
+D4v3::Borderlands::Borderlands2::Edit::EditHistory::edits() const noexcept {
+    return undo_stack;
+}
+
+void D4v3::Borderlands::Borderlands2::Edit::EditHistory::clear() noexcept {
+    undo_stack.clear();
+    redo_stack.clear();
+}
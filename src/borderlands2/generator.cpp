@@ -0,0 +1,157 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/generator.hpp"
+#include "borderlands2/borderlands2.hpp"
+#include "borderlands2/serial.hpp"
+
+#include <random>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+/*!
+ * @brief Creates a pseudo random inventory serial number.
+ *
+ * @details The asset data is random, but the serial is scrambled and carries a valid checksum like the serials
+ *  written by the game.
+ *
+ * @param[in,out] random The random number engine to draw the serial bytes from.
+ * @param[in] is_weapon If the serial should be marked as a weapon.
+ * @return The serial number bytes.
+ */
+std::string generateSerial(std::mt19937 *random, bool is_weapon) {
+    std::uniform_int_distribution<int> byte_distribution(0, 255);
+
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial serial;
+    serial.is_weapon = is_weapon;
+    serial.seed = (uint32_t) (*random)();
+    serial.asset_data.resize(D4v3::Borderlands::Borderlands2::Serial::serial_length - 7);
+    serial.asset_data[0] = 0;
+    for (size_t i = 1; i < serial.asset_data.size(); ++i) {
+        serial.asset_data[i] = (uint8_t) byte_distribution(*random);
+    }
+    return D4v3::Borderlands::Borderlands2::Serial::encodeSerial(serial);
+}
+
+void fillColor(Color *color, int32_t r, int32_t g, int32_t b) {
+    color->set_a(255);
+    color->set_r(r);
+    color->set_g(g);
+    color->set_b(b);
+}
+
+void BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Generator::generateSave(const GeneratorOptions &options,
+                                                        WillowTwoPlayerSaveGame *save_game) noexcept(false) {
+    std::mt19937 random(options.seed);
+
+    save_game->Clear();
+
+    save_game->set_playerclass("GD_Assassin.Character.CharClass_Assassin");
+    save_game->set_explevel(72);
+    save_game->set_exppoints(7738483);
+    save_game->set_generalskillpoints(0);
+    save_game->set_specialistskillpoints(0);
+    save_game->add_currencyonhand(99999999);
+    save_game->add_currencyonhand(500);
+    save_game->add_currencyonhand(0);
+    save_game->set_playthroughscompleted(options.mission_playthroughs > 0 ? options.mission_playthroughs - 1 : 0);
+
+    InventorySlotData *inventory_slots = save_game->mutable_inventoryslotdata();
+    inventory_slots->set_inventoryslotmax(39);
+    inventory_slots->set_weaponreadymax(4);
+    inventory_slots->set_numquickslotsflourished(0);
+
+    save_game->set_statsdata(std::string());
+    save_game->set_lastvisitedteleporter("Sanctuary");
+
+    UIPreferencesData *preferences = save_game->mutable_uipreferences();
+    preferences->set_charactername("Generated");
+    fillColor(preferences->mutable_primarycolor(), 200, 50, 50);
+    fillColor(preferences->mutable_secondarycolor(), 50, 200, 50);
+    fillColor(preferences->mutable_tertiarycolor(), 50, 50, 200);
+
+    save_game->set_savegameid((int32_t) options.seed);
+    save_game->set_plotmissionnumber(0);
+    save_game->set_totalplaytime(360000);
+    save_game->set_lastsaveddate("20191018203000");
+    save_game->set_isbadassmodesavegame(false);
+
+    GUID *guid = save_game->mutable_saveguid();
+    guid->set_a(random());
+    guid->set_b(random());
+    guid->set_c(random());
+    guid->set_d(random());
+
+    save_game->set_activemissionnumber(0);
+
+    ChallengeData *challenge = save_game->mutable_challengelist();
+    challenge->set_challenge("GD_Challenges.Generated.Challenge_0000");
+    challenge->set_isfromdlc(false);
+    challenge->set_dlcpackageid(0);
+
+    save_game->set_numchallengeprestiges(0);
+    save_game->set_numgoldenkeysnotified(0);
+    save_game->set_lastplaythroughnumber(options.mission_playthroughs > 0 ? (int32_t) options.mission_playthroughs - 1 : 0);
+    save_game->set_shownewplaythroughnotification(false);
+    save_game->set_receiveddefaultweapon(true);
+    save_game->set_awesomeskilldisabled(false);
+    save_game->set_maxbankslots((int32_t) options.bank_slots);
+
+    for (uint32_t i = 0; i < options.challenges; ++i) {
+        save_game->add_levelchallengeunlocks((int32_t) i);
+
+        OneOffLevelChallengeData *one_off = save_game->add_oneofflevelchallengecompletion();
+        one_off->set_packageid((int32_t) (i % 8));
+        one_off->set_contentid((int32_t) i);
+        one_off->add_completion(random());
+    }
+
+    for (uint32_t p = 0; p < options.mission_playthroughs; ++p) {
+        MissionPlaythroughData *playthrough = save_game->add_missionplaythroughs();
+        playthrough->set_playthroughnumber((int32_t) p);
+        playthrough->set_activemission("GD_Episode01.M_Ep1_Champion");
+
+        for (uint32_t m = 0; m < options.missions_per_playthrough; ++m) {
+            MissionData *mission = playthrough->add_missiondata();
+            mission->set_mission("GD_Generated.M_Mission_" + std::to_string(m));
+            mission->set_status((MissionStatus) (random() % 6));
+            mission->set_isfromdlc(m % 4 == 0);
+            mission->set_dlcpackageid(m % 4 == 0 ? (int32_t) (m % 7) + 1 : 0);
+            mission->add_objectivesprogress((int32_t) (random() % 10));
+            mission->add_objectivesprogress((int32_t) (random() % 10));
+            mission->set_activeobjectivesetindex(0);
+            mission->set_needsrewards(false);
+            mission->set_heardkickoff(true);
+            mission->set_gamestage((int32_t) (m % 80) + 1);
+        }
+    }
+
+    for (uint32_t i = 0; i < options.bank_slots; ++i) {
+        save_game->add_bankslots()->set_inventoryserialnumber(generateSerial(&random, i % 2 == 0));
+    }
+
+    for (uint32_t i = 0; i < options.packed_weapons; ++i) {
+        PackedWeaponData *weapon = save_game->add_packedweapondata();
+        weapon->set_inventoryserialnumber(generateSerial(&random, true));
+        weapon->set_quickslot(i < 4 ? (QuickWeaponSlot) (i + 1) : QuickWeaponSlot::None);
+        weapon->set_mark(PlayerMark::Standard);
+    }
+
+    for (uint32_t i = 0; i < options.packed_items; ++i) {
+        PackedItemData *item = save_game->add_packeditemdata();
+        item->set_inventoryserialnumber(generateSerial(&random, false));
+        item->set_quantity(1);
+        item->set_equipped(false);
+        item->set_mark(PlayerMark::Standard);
+    }
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Generator::generateSaveFile(const GeneratorOptions &options,
+                                                            const std::string &path) noexcept(false) {
+    WillowTwoPlayerSaveGame save_game;
+    generateSave(options, &save_game);
+    return writeSave(save_game, path);
+}
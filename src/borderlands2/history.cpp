@@ -0,0 +1,346 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/history.hpp"
+#include "borderlands2/diff.hpp"
+#include "borderlands2/edit.hpp"
+#include "common/common.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+/*!
+ * @brief Magic bytes at the start of a version store.
+ */
+static const char STORE_MAGIC[] = {'B', 'L', '2', 'V'};
+
+/*!
+ * @brief Version of the store format, written after the magic bytes.
+ */
+constexpr uint8_t STORE_FORMAT_VERSION = 1;
+
+constexpr size_t STORE_HEADER_SIZE = sizeof(STORE_MAGIC) + 1;
+
+/*!
+ * @brief Size of the record header, the record kind and the payload size.
+ */
+constexpr size_t RECORD_HEADER_SIZE = 1 + sizeof(uint32_t);
+
+constexpr uint8_t RECORD_BASE = 0;
+constexpr uint8_t RECORD_DELTA = 1;
+
+/*!
+ * @brief Flags of an encoded value, members that are not set are zero.
+ */
+constexpr uint8_t VALUE_PRESENT = 0x01;
+constexpr uint8_t VALUE_INTEGER = 0x02;
+constexpr uint8_t VALUE_FLOATING = 0x04;
+constexpr uint8_t VALUE_BYTES = 0x08;
+
+void encodeValue(const D4v3::Borderlands::Borderlands2::Edit::FieldValue &value,
+                 D4v3::Borderlands::Common::Streams::ByteWriter *writer) {
+    uint8_t flags = (value.present ? VALUE_PRESENT : 0) |
+                    (value.integer != 0 ? VALUE_INTEGER : 0) |
+                    (value.floating != 0 ? VALUE_FLOATING : 0) |
+                    (!value.bytes.empty() ? VALUE_BYTES : 0);
+    writer->write<uint8_t, D4v3::Borderlands::Common::Streams::little_endian>(flags);
+
+    if ((flags & VALUE_INTEGER) != 0) {
+        // Zig zag encoding keeps small negative numbers short.
+        writer->write_varint(((uint64_t) value.integer << 1) ^ (uint64_t) (value.integer >> 63));
+    }
+    if ((flags & VALUE_FLOATING) != 0) {
+        uint64_t bits;
+        std::memcpy(&bits, &value.floating, sizeof(bits));
+        writer->write<uint64_t, D4v3::Borderlands::Common::Streams::little_endian>(bits);
+    }
+    if ((flags & VALUE_BYTES) != 0) {
+        writer->write_varint(value.bytes.size());
+        writer->write_bytes(value.bytes.data(), value.bytes.size());
+    }
+}
+
+D4v3::Borderlands::Borderlands2::Edit::FieldValue decodeValue(D4v3::Borderlands::Common::Streams::ByteReader *reader) {
+    D4v3::Borderlands::Borderlands2::Edit::FieldValue value;
+    const auto flags = reader->read<uint8_t, D4v3::Borderlands::Common::Streams::little_endian>();
+    value.present = (flags & VALUE_PRESENT) != 0;
+
+    if ((flags & VALUE_INTEGER) != 0) {
+        const uint64_t encoded = reader->read_varint();
+        value.integer = (int64_t) (encoded >> 1) ^ -(int64_t) (encoded & 1);
+    }
+    if ((flags & VALUE_FLOATING) != 0) {
+        const auto bits = reader->read<uint64_t, D4v3::Borderlands::Common::Streams::little_endian>();
+        std::memcpy(&value.floating, &bits, sizeof(bits));
+    }
+    if ((flags & VALUE_BYTES) != 0) {
+        const uint64_t size = reader->read_varint();
+        if (size > reader->remaining()) {
+            throw std::out_of_range("Value is longer than the delta!");
+        }
+        const uint8_t *data = reader->read_bytes((size_t) size);
+        value.bytes.assign(reinterpret_cast<const char *>(data), (size_t) size);
+    }
+    return value;
+}
+
+/*!
+ * @brief Encodes the edits of a delta.
+ *
+ * @details Deltas are only applied forward, so only the new values are stored.
+ */
+void encodeEdits(const std::vector<D4v3::Borderlands::Borderlands2::Edit::FieldEdit> &edits, std::vector<uint8_t> *payload) {
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(payload);
+    writer.write_varint(edits.size());
+    for (const auto &edit : edits) {
+        writer.write_varint(edit.path.size());
+        for (const auto &element : edit.path) {
+            writer.write_varint((uint32_t) element.field_number);
+            writer.write_varint((uint32_t) (element.index + 1));
+        }
+        writer.write<uint8_t, D4v3::Borderlands::Common::Streams::little_endian>((uint8_t) edit.operation);
+        if (edit.operation != D4v3::Borderlands::Borderlands2::Edit::Operation::remove) {
+            encodeValue(edit.new_value, &writer);
+        }
+    }
+}
+
+/*!
+ * @throw std::out_of_range If the delta is truncated.
+ * @throw std::invalid_argument If the delta holds an invalid varint or operation.
+ */
+void decodeEdits(const std::vector<uint8_t> &payload, std::vector<D4v3::Borderlands::Borderlands2::Edit::FieldEdit> *edits) {
+    D4v3::Borderlands::Common::Streams::ByteReader reader(payload.data(), payload.size());
+    const uint64_t count = reader.read_varint();
+    edits->clear();
+    edits->reserve((size_t) std::min<uint64_t>(count, payload.size()));
+
+    for (uint64_t i = 0; i < count; ++i) {
+        D4v3::Borderlands::Borderlands2::Edit::FieldEdit edit;
+        const uint64_t path_size = reader.read_varint();
+        for (uint64_t j = 0; j < path_size; ++j) {
+            const auto field_number = (int32_t) reader.read_varint();
+            const auto index = (int32_t) reader.read_varint() - 1;
+            edit.path.push_back({field_number, index});
+        }
+
+        const auto operation = reader.read<uint8_t, D4v3::Borderlands::Common::Streams::little_endian>();
+        if (operation > D4v3::Borderlands::Borderlands2::Edit::Operation::remove) {
+            throw std::invalid_argument("Unknown edit operation!");
+        }
+        edit.operation = (D4v3::Borderlands::Borderlands2::Edit::Operation) operation;
+        if (edit.operation != D4v3::Borderlands::Borderlands2::Edit::Operation::remove) {
+            edit.new_value = decodeValue(&reader);
+        }
+        edits->push_back(std::move(edit));
+    }
+}
+
+D4v3::Borderlands::Borderlands2::History::VersionStore::VersionStore(std::string path, size_t rebase_interval) noexcept
+        : path(std::move(path)), rebase_interval(std::max<size_t>(rebase_interval, 1)), opened(false) {
+}
+
+D4v3::Borderlands::Borderlands2::History::VersionStore::~VersionStore() = default;
+
+bool D4v3::Borderlands::Borderlands2::History::VersionStore::open() noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    records.clear();
+    latest.reset();
+    opened = false;
+
+    const boost::filesystem::path store_file(path);
+    if (!boost::filesystem::exists(store_file)) {
+        boost::filesystem::ofstream stream(store_file, std::ios::out | std::ios::binary);
+        stream.write(STORE_MAGIC, sizeof(STORE_MAGIC));
+        stream.put((char) STORE_FORMAT_VERSION);
+        if (!stream.good()) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to create version store: " << path;
+            return false;
+        }
+        opened = true;
+        return true;
+    }
+
+    const uint64_t file_size = boost::filesystem::file_size(store_file);
+    boost::filesystem::ifstream stream(store_file, std::ios::in | std::ios::binary);
+    char header[STORE_HEADER_SIZE];
+    if (!stream.read(header, sizeof(header)) || std::memcmp(header, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0 ||
+        (uint8_t) header[sizeof(STORE_MAGIC)] != STORE_FORMAT_VERSION) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "File is no version store: " << path;
+        return false;
+    }
+
+    // Only the record headers are read, the payloads are skipped.
+    uint64_t offset = STORE_HEADER_SIZE;
+    uint8_t record_header[RECORD_HEADER_SIZE];
+    while (offset + RECORD_HEADER_SIZE <= file_size &&
+           stream.seekg((std::streamoff) offset).read(reinterpret_cast<char *>(record_header), sizeof(record_header))) {
+        D4v3::Borderlands::Common::Streams::ByteReader reader(record_header, sizeof(record_header));
+        const auto kind = reader.read<uint8_t, D4v3::Borderlands::Common::Streams::little_endian>();
+        const auto size = reader.read<uint32_t, D4v3::Borderlands::Common::Streams::little_endian>();
+        if (kind > RECORD_DELTA || (records.empty() && kind != RECORD_BASE) ||
+            offset + RECORD_HEADER_SIZE + size > file_size) {
+            break;
+        }
+
+        records.push_back({kind == RECORD_BASE, offset + RECORD_HEADER_SIZE, size});
+        offset += RECORD_HEADER_SIZE + size;
+    }
+    stream.close();
+
+    if (offset != file_size) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+            << "Dropping incomplete record at offset " << offset << " of version store: " << path;
+        boost::filesystem::resize_file(store_file, offset);
+    }
+
+    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::debug)
+        << "Opened version store with " << records.size() << " versions: " << path;
+    opened = true;
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::History::VersionStore::append(const WillowTwoPlayerSaveGame &save_game) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    if (!opened) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Version store is not open: " << path;
+        return false;
+    }
+
+    if (!latest) {
+        latest.reset(new WillowTwoPlayerSaveGame());
+        if (!records.empty() && !read(records.size() - 1, latest.get())) {
+            latest.reset();
+            return false;
+        }
+    }
+
+    size_t since_base = 0;
+    while (since_base < records.size() && !records[records.size() - 1 - since_base].base) {
+        ++since_base;
+    }
+
+    std::vector<uint8_t> payload;
+    const size_t save_size = save_game.ByteSizeLong();
+    bool base = records.empty() || since_base + 1 >= rebase_interval;
+    if (!base) {
+        std::vector<Edit::FieldEdit> edits;
+        Diff::diffEdits(*latest, save_game, &edits);
+        encodeEdits(edits, &payload);
+        base = payload.size() >= save_size;
+    }
+    if (base) {
+        payload.resize(save_size);
+        if (!save_game.SerializeToArray(payload.data(), (int) payload.size())) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Failed to serialize the save for the version store!";
+            return false;
+        }
+    }
+
+    std::vector<uint8_t> record;
+    record.reserve(RECORD_HEADER_SIZE + payload.size());
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&record);
+    writer.write<uint8_t, D4v3::Borderlands::Common::Streams::little_endian>(base ? RECORD_BASE : RECORD_DELTA);
+    writer.write<uint32_t, D4v3::Borderlands::Common::Streams::little_endian>((uint32_t) payload.size());
+    writer.write_bytes(payload.data(), payload.size());
+
+    // The record is written behind the last indexed one instead of at the end of the file, and a failed
+    // write is cut off again, so bytes of an earlier failed append never end up in front of a record.
+    const uint64_t offset = records.empty() ? STORE_HEADER_SIZE : records.back().offset + records.back().size;
+    boost::filesystem::fstream stream(boost::filesystem::path(path), std::ios::in | std::ios::out | std::ios::binary);
+    stream.seekp((std::streamoff) offset);
+    stream.write(reinterpret_cast<const char *>(record.data()), (std::streamsize) record.size());
+    stream.flush();
+    if (!stream.good()) {
+        stream.close();
+        boost::system::error_code error;
+        boost::filesystem::resize_file(boost::filesystem::path(path), offset, error);
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to append to version store: " << path;
+        return false;
+    }
+
+    records.push_back({base, offset + RECORD_HEADER_SIZE, (uint32_t) payload.size()});
+    latest->CopyFrom(save_game);
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::History::VersionStore::read(size_t version,
+                                                                  WillowTwoPlayerSaveGame *save_game) const noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    if (version >= records.size()) {
+        return false;
+    }
+
+    size_t base = version;
+    while (!records[base].base) {
+        --base;
+    }
+
+    boost::filesystem::ifstream stream(boost::filesystem::path(path), std::ios::in | std::ios::binary);
+    std::vector<uint8_t> payload;
+    if (!readRecord(stream, records[base], &payload) ||
+        !save_game->ParseFromArray(payload.data(), (int) payload.size())) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to read base of version " << version << " from version store: " << path;
+        return false;
+    }
+
+    std::vector<Edit::FieldEdit> edits;
+    for (size_t current = base + 1; current <= version; ++current) {
+        try {
+            if (!readRecord(stream, records[current], &payload)) {
+                return false;
+            }
+            decodeEdits(payload, &edits);
+        } catch (std::exception &ex) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Damaged delta of version " << current << ": " << ex.what();
+            return false;
+        }
+
+        if (!Edit::applyEdits(edits, save_game)) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Delta of version " << current << " does not apply to the previous version!";
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t D4v3::Borderlands::Borderlands2::History::VersionStore::size() const noexcept {
+    return records.size();
+}
+
+bool D4v3::Borderlands::Borderlands2::History::VersionStore::isBase(size_t version) const noexcept {
+    return version < records.size() && records[version].base;
+}
+
+bool D4v3::Borderlands::Borderlands2::History::VersionStore::readRecord(std::istream &stream, const Record &record,
+                                                                        std::vector<uint8_t> *payload) const noexcept(false) {
+    payload->resize(record.size);
+    stream.seekg((std::streamoff) record.offset);
+    stream.read(reinterpret_cast<char *>(payload->data()), (std::streamsize) record.size);
+    return !stream.fail();
+}
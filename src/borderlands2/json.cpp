@@ -0,0 +1,638 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/json.hpp"
+#include "borderlands2/serial.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+using google::protobuf::EnumValueDescriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+/*!
+ * @brief Size of the buffer the JSON is written to before it is passed to the file, and read into from the file.
+ */
+constexpr size_t JSON_BUFFER_SIZE = 64 * 1024;
+
+/*!
+ * @brief Writes bytes as a hex string.
+ *
+ * @details Serials fit into the buffer on the stack, only longer values allocate.
+ */
+template<typename Writer>
+void writeHex(const uint8_t *data, size_t size, Writer *writer) {
+    static const char digits[] = "0123456789abcdef";
+    char hex[2 * D4v3::Borderlands::Borderlands2::Serial::serial_length];
+    std::vector<char> large;
+    char *output = hex;
+    if (2 * size > sizeof(hex)) {
+        large.resize(2 * size);
+        output = large.data();
+    }
+    for (size_t i = 0; i < size; ++i) {
+        output[2 * i] = digits[data[i] >> 4];
+        output[2 * i + 1] = digits[data[i] & 0x0F];
+    }
+    writer->String(output, (rapidjson::SizeType) (2 * size), true);
+}
+
+/*!
+ * @brief Writes the decoded parts of an inventory serial, nothing if the serial can not be decoded.
+ */
+template<typename Writer>
+void writeSerial(const std::string &serial, Writer *writer) {
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    if (!D4v3::Borderlands::Borderlands2::Serial::decodeSerial(serial, &decoded)) {
+        return;
+    }
+
+    writer->Key("InventorySerial");
+    writer->StartObject();
+    writer->Key("IsWeapon");
+    writer->Bool(decoded.is_weapon);
+    writer->Key("Version");
+    writer->Uint(decoded.version);
+    writer->Key("Seed");
+    writer->Uint(decoded.seed);
+    writer->Key("Checksum");
+    writer->Uint(decoded.checksum);
+    writer->Key("AssetLibrarySetId");
+    writer->Uint(decoded.asset_library_set_id);
+    writer->Key("AssetData");
+    writeHex(decoded.asset_data.data(), decoded.asset_data.size(), writer);
+    writer->EndObject();
+}
+
+template<typename Writer>
+void writeMessage(const Message &message, Writer *writer);
+
+/*!
+ * @brief Writes a singular field, or an element of a repeated field if index is not -1.
+ */
+template<typename Writer>
+void writeValue(const Message &message, const FieldDescriptor *field, int index, Writer *writer) {
+    const Reflection *reflection = message.GetReflection();
+    const bool repeated = index >= 0;
+
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            writer->Int(repeated ? reflection->GetRepeatedInt32(message, field, index) : reflection->GetInt32(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            writer->Int64(repeated ? reflection->GetRepeatedInt64(message, field, index) : reflection->GetInt64(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            writer->Uint(repeated ? reflection->GetRepeatedUInt32(message, field, index) : reflection->GetUInt32(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            writer->Uint64(repeated ? reflection->GetRepeatedUInt64(message, field, index) : reflection->GetUInt64(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            writer->Bool(repeated ? reflection->GetRepeatedBool(message, field, index) : reflection->GetBool(message, field));
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+        case FieldDescriptor::CPPTYPE_DOUBLE: {
+            double value;
+            if (field->cpp_type() == FieldDescriptor::CPPTYPE_FLOAT) {
+                value = repeated ? reflection->GetRepeatedFloat(message, field, index) : reflection->GetFloat(message, field);
+            } else {
+                value = repeated ? reflection->GetRepeatedDouble(message, field, index) : reflection->GetDouble(message, field);
+            }
+            // The writer fails on NaN and infinity, which have no JSON representation.
+            if (std::isfinite(value)) {
+                writer->Double(value);
+            } else {
+                writer->Null();
+            }
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_ENUM: {
+            const std::string &name = (repeated ? reflection->GetRepeatedEnum(message, field, index) : reflection->GetEnum(message, field))->name();
+            writer->String(name.data(), (rapidjson::SizeType) name.size());
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_STRING: {
+            std::string scratch;
+            const std::string &value = repeated ? reflection->GetRepeatedStringReference(message, field, index, &scratch)
+                                                : reflection->GetStringReference(message, field, &scratch);
+            if (field->type() == FieldDescriptor::TYPE_BYTES) {
+                writeHex(reinterpret_cast<const uint8_t *>(value.data()), value.size(), writer);
+            } else {
+                writer->String(value.data(), (rapidjson::SizeType) value.size());
+            }
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_MESSAGE:
+            writeMessage(repeated ? reflection->GetRepeatedMessage(message, field, index) : reflection->GetMessage(message, field), writer);
+            break;
+    }
+}
+
+template<typename Writer>
+void writeMessage(const Message &message, Writer *writer) {
+    const Reflection *reflection = message.GetReflection();
+    std::vector<const FieldDescriptor *> fields;
+    reflection->ListFields(message, &fields);
+
+    writer->StartObject();
+    for (const FieldDescriptor *field : fields) {
+        writer->Key(field->name().data(), (rapidjson::SizeType) field->name().size());
+        if (field->is_repeated()) {
+            writer->StartArray();
+            const int size = reflection->FieldSize(message, field);
+            for (int index = 0; index < size; ++index) {
+                writeValue(message, field, index, writer);
+            }
+            writer->EndArray();
+        } else {
+            writeValue(message, field, -1, writer);
+            if (field->type() == FieldDescriptor::TYPE_BYTES && field->name() == "InventorySerialNumber") {
+                std::string scratch;
+                writeSerial(reflection->GetStringReference(message, field, &scratch), writer);
+            }
+        }
+    }
+    writer->EndObject();
+}
+
+/*!
+ * @brief Sets a scalar of the field of frame, appending it if the field is an array.
+ */
+#define BL2_JSON_SET(FRAME, TYPE, VALUE) \
+    ((FRAME)->array ? (FRAME)->message->GetReflection()->Add##TYPE((FRAME)->message, (FRAME)->field, VALUE) \
+                    : (FRAME)->message->GetReflection()->Set##TYPE((FRAME)->message, (FRAME)->field, VALUE))
+
+/*!
+ * @brief SAX handler that fills a message while the JSON is read.
+ *
+ * @details Every open object is a frame on a stack. The key read last selects the field of the frame the next
+ *  value is stored in. Returning false stops the reader, the reason is kept in error.
+ */
+class ImportHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ImportHandler> {
+public:
+    explicit ImportHandler(Message *root) : root(root) {}
+
+    bool Null() {
+        Frame *frame;
+        if (!scalarFrame(&frame) || frame == nullptr) {
+            return frame == nullptr && error.empty();
+        }
+        // Floats that are not finite are exported as null.
+        switch (frame->field->cpp_type()) {
+            case FieldDescriptor::CPPTYPE_FLOAT:
+                BL2_JSON_SET(frame, Float, std::numeric_limits<float>::quiet_NaN());
+                break;
+            case FieldDescriptor::CPPTYPE_DOUBLE:
+                BL2_JSON_SET(frame, Double, std::numeric_limits<double>::quiet_NaN());
+                break;
+            default:
+                return typeError(frame, "null");
+        }
+        return endScalar(frame);
+    }
+
+    bool Bool(bool value) {
+        Frame *frame;
+        if (!scalarFrame(&frame) || frame == nullptr) {
+            return frame == nullptr && error.empty();
+        }
+        if (frame->field->cpp_type() != FieldDescriptor::CPPTYPE_BOOL) {
+            return typeError(frame, "bool");
+        }
+        BL2_JSON_SET(frame, Bool, value);
+        return endScalar(frame);
+    }
+
+    bool Int(int value) {
+        return Int64(value);
+    }
+
+    bool Uint(unsigned value) {
+        return Uint64(value);
+    }
+
+    bool Int64(int64_t value) {
+        return value < 0 ? setInteger(static_cast<uint64_t>(value), true) : Uint64(static_cast<uint64_t>(value));
+    }
+
+    bool Uint64(uint64_t value) {
+        return setInteger(value, false);
+    }
+
+    bool Double(double value) {
+        Frame *frame;
+        if (!scalarFrame(&frame) || frame == nullptr) {
+            return frame == nullptr && error.empty();
+        }
+        switch (frame->field->cpp_type()) {
+            case FieldDescriptor::CPPTYPE_FLOAT:
+                BL2_JSON_SET(frame, Float, static_cast<float>(value));
+                break;
+            case FieldDescriptor::CPPTYPE_DOUBLE:
+                BL2_JSON_SET(frame, Double, value);
+                break;
+            default:
+                return typeError(frame, "number with a fraction");
+        }
+        return endScalar(frame);
+    }
+
+    bool String(const char *value, rapidjson::SizeType length, bool) {
+        Frame *frame;
+        if (!scalarFrame(&frame) || frame == nullptr) {
+            return frame == nullptr && error.empty();
+        }
+        switch (frame->field->cpp_type()) {
+            case FieldDescriptor::CPPTYPE_STRING:
+                if (frame->field->type() == FieldDescriptor::TYPE_BYTES) {
+                    std::string bytes;
+                    if (!readHex(value, length, &bytes)) {
+                        return fail("Invalid hex string for " + frame->field->full_name());
+                    }
+                    BL2_JSON_SET(frame, String, std::move(bytes));
+                } else {
+                    BL2_JSON_SET(frame, String, std::string(value, length));
+                }
+                break;
+            case FieldDescriptor::CPPTYPE_ENUM: {
+                const EnumValueDescriptor *enum_value = frame->field->enum_type()->FindValueByName(std::string(value, length));
+                if (enum_value == nullptr) {
+                    return fail("Unknown value " + std::string(value, length) + " for " + frame->field->full_name());
+                }
+                BL2_JSON_SET(frame, Enum, enum_value);
+                break;
+            }
+            default:
+                return typeError(frame, "string");
+        }
+        return endScalar(frame);
+    }
+
+    bool StartObject() {
+        if (skipping()) {
+            ++skip_depth;
+            return true;
+        }
+        if (frames.empty()) {
+            frames.push_back({root, nullptr, false});
+            return true;
+        }
+
+        Frame &parent = frames.back();
+        if (parent.field == nullptr || parent.field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+            return typeError(&parent, "object");
+        }
+        if (parent.field->is_repeated() != parent.array) {
+            return fail("Expected an array for " + parent.field->full_name());
+        }
+
+        const Reflection *reflection = parent.message->GetReflection();
+        Message *message = parent.array ? reflection->AddMessage(parent.message, parent.field)
+                                        : reflection->MutableMessage(parent.message, parent.field);
+        if (!parent.array) {
+            parent.field = nullptr;
+        }
+        frames.push_back({message, nullptr, false});
+        return true;
+    }
+
+    bool Key(const char *name, rapidjson::SizeType length, bool) {
+        if (skip_depth > 0) {
+            return true;
+        }
+
+        Frame &frame = frames.back();
+        const std::string key(name, length);
+        frame.field = frame.message->GetDescriptor()->FindFieldByName(key);
+        if (frame.field == nullptr) {
+            // The decoded serial is only written for reading, the serial itself is the source.
+            if (key == "InventorySerial") {
+                skip_value = true;
+                return true;
+            }
+            return fail("Unknown field " + key + " in " + frame.message->GetDescriptor()->full_name());
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        if (skip_depth > 0) {
+            --skip_depth;
+            return true;
+        }
+
+        const Message *message = frames.back().message;
+        const google::protobuf::Descriptor *descriptor = message->GetDescriptor();
+        for (int i = 0; i < descriptor->field_count(); ++i) {
+            const FieldDescriptor *field = descriptor->field(i);
+            if (field->is_required() && !message->GetReflection()->HasField(*message, field)) {
+                return fail("Missing required field " + field->full_name());
+            }
+        }
+        frames.pop_back();
+        return true;
+    }
+
+    bool StartArray() {
+        if (skipping()) {
+            ++skip_depth;
+            return true;
+        }
+        if (frames.empty()) {
+            return fail("Expected an object for the save");
+        }
+
+        Frame &frame = frames.back();
+        if (frame.field == nullptr || !frame.field->is_repeated() || frame.array) {
+            return typeError(&frame, "array");
+        }
+        frame.array = true;
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        if (skip_depth > 0) {
+            --skip_depth;
+            return true;
+        }
+
+        frames.back().array = false;
+        frames.back().field = nullptr;
+        return true;
+    }
+
+    /*!
+     * @brief The reason the handler stopped the reader, empty if it did not.
+     */
+    std::string error;
+
+private:
+    /*!
+     * @brief An open object and the field its next value is stored in.
+     */
+    struct Frame {
+        Message *message;
+        const FieldDescriptor *field;
+        bool array;
+    };
+
+    /*!
+     * @brief Returns true if the value that starts now is skipped, consuming a pending skip.
+     */
+    bool skipping() {
+        const bool skip = skip_value || skip_depth > 0;
+        skip_value = false;
+        return skip;
+    }
+
+    /*!
+     * @brief Finds the frame a scalar is stored in.
+     *
+     * @param[out] frame The frame, nullptr if the scalar is skipped or can not be stored.
+     * @return false if the scalar is not expected here.
+     */
+    bool scalarFrame(Frame **frame) {
+        *frame = nullptr;
+        if (skipping()) {
+            return true;
+        }
+        if (frames.empty()) {
+            return fail("Expected an object for the save");
+        }
+        if (frames.back().field == nullptr) {
+            return fail("Unexpected value in " + frames.back().message->GetDescriptor()->full_name());
+        }
+        if (frames.back().field->is_repeated() != frames.back().array) {
+            return fail("Expected an array for " + frames.back().field->full_name());
+        }
+        *frame = &frames.back();
+        return true;
+    }
+
+    /*!
+     * @brief Clears the field of frame after a singular value, the next value needs a new key.
+     */
+    static bool endScalar(Frame *frame) {
+        if (!frame->array) {
+            frame->field = nullptr;
+        }
+        return true;
+    }
+
+    /*!
+     * @brief Sets an integer, negative values are passed as their two's complement.
+     */
+    bool setInteger(uint64_t value, bool negative) {
+        Frame *frame;
+        if (!scalarFrame(&frame) || frame == nullptr) {
+            return frame == nullptr && error.empty();
+        }
+
+        const auto signed_value = static_cast<int64_t>(value);
+        switch (frame->field->cpp_type()) {
+            case FieldDescriptor::CPPTYPE_INT32:
+                if (negative ? signed_value < std::numeric_limits<int32_t>::min()
+                             : value > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+                    return rangeError(frame);
+                }
+                BL2_JSON_SET(frame, Int32, static_cast<int32_t>(signed_value));
+                break;
+            case FieldDescriptor::CPPTYPE_INT64:
+                if (!negative && value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                    return rangeError(frame);
+                }
+                BL2_JSON_SET(frame, Int64, signed_value);
+                break;
+            case FieldDescriptor::CPPTYPE_UINT32:
+                if (negative || value > std::numeric_limits<uint32_t>::max()) {
+                    return rangeError(frame);
+                }
+                BL2_JSON_SET(frame, UInt32, static_cast<uint32_t>(value));
+                break;
+            case FieldDescriptor::CPPTYPE_UINT64:
+                if (negative) {
+                    return rangeError(frame);
+                }
+                BL2_JSON_SET(frame, UInt64, value);
+                break;
+            case FieldDescriptor::CPPTYPE_FLOAT:
+                BL2_JSON_SET(frame, Float, negative ? static_cast<float>(signed_value) : static_cast<float>(value));
+                break;
+            case FieldDescriptor::CPPTYPE_DOUBLE:
+                BL2_JSON_SET(frame, Double, negative ? static_cast<double>(signed_value) : static_cast<double>(value));
+                break;
+            default:
+                return typeError(frame, "integer");
+        }
+        return endScalar(frame);
+    }
+
+    /*!
+     * @brief Decodes a hex string as written by writeHex.
+     */
+    static bool readHex(const char *hex, size_t length, std::string *bytes) {
+        if (length % 2 != 0) {
+            return false;
+        }
+        bytes->resize(length / 2);
+        for (size_t i = 0; i < length; i += 2) {
+            int high = hexDigit(hex[i]);
+            int low = hexDigit(hex[i + 1]);
+            if (high < 0 || low < 0) {
+                return false;
+            }
+            (*bytes)[i / 2] = static_cast<char>(high << 4 | low);
+        }
+        return true;
+    }
+
+    static int hexDigit(char digit) {
+        if (digit >= '0' && digit <= '9') {
+            return digit - '0';
+        }
+        if (digit >= 'a' && digit <= 'f') {
+            return digit - 'a' + 10;
+        }
+        if (digit >= 'A' && digit <= 'F') {
+            return digit - 'A' + 10;
+        }
+        return -1;
+    }
+
+    bool typeError(const Frame *frame, const char *found) {
+        if (frame->field == nullptr) {
+            return fail(std::string("Unexpected ") + found + " in " + frame->message->GetDescriptor()->full_name());
+        }
+        return fail(std::string("Unexpected ") + found + " for " + frame->field->full_name());
+    }
+
+    bool rangeError(const Frame *frame) {
+        return fail("Value out of range for " + frame->field->full_name());
+    }
+
+    bool fail(const std::string &reason) {
+        error = reason;
+        return false;
+    }
+
+    Message *root;
+    std::vector<Frame> frames;
+    bool skip_value = false;
+    size_t skip_depth = 0;
+};
+
+#undef BL2_JSON_SET
+
+/*!
+ * @brief Parses a save from a rapidjson input stream.
+ */
+template<typename Stream>
+bool parseJson(Stream *stream, WillowTwoPlayerSaveGame *save_game) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    save_game->Clear();
+    ImportHandler handler(save_game);
+    rapidjson::Reader reader;
+    const rapidjson::ParseResult result = reader.Parse<rapidjson::kParseDefaultFlags>(*stream, handler);
+    if (result.IsError()) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to import JSON at offset " << result.Offset() << ": "
+            << (handler.error.empty() ? rapidjson::GetParseError_En(result.Code()) : handler.error.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Json::exportJson(const WillowTwoPlayerSaveGame &save_game,
+                                                  std::FILE *file) noexcept(false) {
+    std::vector<char> buffer(JSON_BUFFER_SIZE);
+    rapidjson::FileWriteStream stream(file, buffer.data(), buffer.size());
+    rapidjson::Writer<rapidjson::FileWriteStream> writer(stream);
+
+    writeMessage(save_game, &writer);
+    stream.Flush();
+    return writer.IsComplete() && std::ferror(file) == 0;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Json::exportJson(const WillowTwoPlayerSaveGame &save_game,
+                                                  const std::string &path) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to open JSON file: " << path;
+        return false;
+    }
+
+    bool success = exportJson(save_game, file);
+    success = std::fclose(file) == 0 && success;
+    if (!success) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to write JSON file: " << path;
+    }
+    return success;
+}
+
+std::string BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Json::toJson(const WillowTwoPlayerSaveGame &save_game) noexcept(false) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writeMessage(save_game, &writer);
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Json::importJson(std::FILE *file, WillowTwoPlayerSaveGame *save_game) noexcept(false) {
+    std::vector<char> buffer(JSON_BUFFER_SIZE);
+    rapidjson::FileReadStream stream(file, buffer.data(), buffer.size());
+    return parseJson(&stream, save_game);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Json::importJson(const std::string &path,
+                                                  WillowTwoPlayerSaveGame *save_game) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Failed to open JSON file: " << path;
+        return false;
+    }
+
+    const bool success = importJson(file, save_game);
+    std::fclose(file);
+    return success;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Json::fromJson(const std::string &json,
+                                                WillowTwoPlayerSaveGame *save_game) noexcept(false) {
+    rapidjson::StringStream stream(json.c_str());
+    return parseJson(&stream, save_game);
+}
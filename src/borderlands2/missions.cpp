@@ -0,0 +1,127 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/missions.hpp"
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+static_assert(D4v3::Borderlands::Borderlands2::Missions::status_count == MissionStatus_ARRAYSIZE,
+              "status_count has to match MissionStatus!");
+
+size_t D4v3::Borderlands::Borderlands2::Missions::MissionNames::intern(const std::string &name) noexcept(false) {
+    auto inserted = positions.emplace(name, names.size());
+    if (inserted.second) {
+        names.push_back(name);
+    }
+    return inserted.first->second;
+}
+
+bool D4v3::Borderlands::Borderlands2::Missions::MissionNames::find(const std::string &name,
+                                                                   size_t *position) const noexcept(false) {
+    auto found = positions.find(name);
+    if (found == positions.end()) {
+        return false;
+    }
+    *position = found->second;
+    return true;
+}
+
+const std::string &D4v3::Borderlands::Borderlands2::Missions::MissionNames::name(size_t position) const noexcept(false) {
+    return names.at(position);
+}
+
+size_t D4v3::Borderlands::Borderlands2::Missions::MissionNames::size() const noexcept(false) {
+    return names.size();
+}
+
+D4v3::Borderlands::Borderlands2::Missions::MissionIndex::MissionIndex(
+        std::shared_ptr<MissionNames> names) noexcept(false) : mission_names(std::move(names)) {
+}
+
+void D4v3::Borderlands::Borderlands2::Missions::MissionIndex::build(const WillowTwoPlayerSaveGame &save_game) noexcept(false) {
+    playthroughs.clear();
+
+    for (int p = 0; p < save_game.missionplaythroughs_size(); ++p) {
+        const MissionPlaythroughData &playthrough = save_game.missionplaythroughs(p);
+        // The number is read from the file, it is trusted only if it could be the position of a playthrough.
+        int32_t number = p;
+        if (playthrough.has_playthroughnumber() && playthrough.playthroughnumber() >= 0 &&
+            playthrough.playthroughnumber() < save_game.missionplaythroughs_size()) {
+            number = playthrough.playthroughnumber();
+        }
+        if ((size_t) number >= playthroughs.size()) {
+            playthroughs.resize(number + 1);
+        }
+        auto &sets = playthroughs[number];
+
+        for (const MissionData &mission : playthrough.missiondata()) {
+            const size_t position = mission_names->intern(mission.mission());
+            for (MissionSet &set : sets) {
+                if (set.size() <= position) {
+                    set.resize(mission_names->size());
+                }
+                set.reset(position);
+            }
+            sets[mission.status()].set(position);
+        }
+    }
+}
+
+size_t D4v3::Borderlands::Borderlands2::Missions::MissionIndex::playthroughCount() const noexcept(false) {
+    return playthroughs.size();
+}
+
+D4v3::Borderlands::Borderlands2::Missions::MissionSet
+D4v3::Borderlands::Borderlands2::Missions::MissionIndex::missions(size_t playthrough, int status) const noexcept(false) {
+    if (playthrough >= playthroughs.size() || status < 0 || status >= status_count) {
+        return MissionSet(mission_names->size());
+    }
+    return resized(playthroughs[playthrough][status]);
+}
+
+D4v3::Borderlands::Borderlands2::Missions::MissionSet
+D4v3::Borderlands::Borderlands2::Missions::MissionIndex::known(size_t playthrough) const noexcept(false) {
+    MissionSet set(mission_names->size());
+    if (playthrough < playthroughs.size()) {
+        for (const MissionSet &status : playthroughs[playthrough]) {
+            set |= resized(status);
+        }
+    }
+    return set;
+}
+
+int D4v3::Borderlands::Borderlands2::Missions::MissionIndex::status(size_t playthrough,
+                                                                     const std::string &mission) const noexcept(false) {
+    size_t position;
+    if (playthrough >= playthroughs.size() || !mission_names->find(mission, &position)) {
+        return -1;
+    }
+    for (int status = 0; status < status_count; ++status) {
+        const MissionSet &set = playthroughs[playthrough][status];
+        if (position < set.size() && set.test(position)) {
+            return status;
+        }
+    }
+    return -1;
+}
+
+std::vector<std::string>
+D4v3::Borderlands::Borderlands2::Missions::MissionIndex::missionNames(const MissionSet &set) const noexcept(false) {
+    std::vector<std::string> result;
+    for (size_t position = set.find_first(); position != MissionSet::npos; position = set.find_next(position)) {
+        result.push_back(mission_names->name(position));
+    }
+    return result;
+}
+
+const std::shared_ptr<D4v3::Borderlands::Borderlands2::Missions::MissionNames> &
+D4v3::Borderlands::Borderlands2::Missions::MissionIndex::names() const noexcept(false) {
+    return mission_names;
+}
+
+D4v3::Borderlands::Borderlands2::Missions::MissionSet
+D4v3::Borderlands::Borderlands2::Missions::MissionIndex::resized(MissionSet set) const noexcept(false) {
+    set.resize(mission_names->size());
+    return set;
+}
@@ -0,0 +1,715 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/query.hpp"
+#include "borderlands2/borderlands2.hpp"
+#include "borderlands2/wire_format.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <common/common.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+using D4v3::Borderlands::Borderlands2::Query::Comparison;
+using D4v3::Borderlands::Borderlands2::Query::Condition;
+using D4v3::Borderlands::Borderlands2::Query::SaveQuery;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+/*!
+ * @brief The value of a field, numbers and bools are kept as double.
+ */
+struct FieldValue {
+    bool is_text = false;
+    double number = 0;
+    std::string text;
+};
+
+/*!
+ * @brief A condition with its field and value resolved against the save descriptors.
+ */
+struct ResolvedCondition {
+    const FieldDescriptor *field;
+    Comparison comparison;
+    FieldValue value;
+};
+
+/*!
+ * @brief A repeated message of the save that can be queried.
+ *
+ * @details parent is set for messages nested in another repeated message, like the MissionData of every
+ *  MissionPlaythroughs element.
+ */
+struct Scope {
+    std::string name;
+    const FieldDescriptor *parent;
+    const FieldDescriptor *field;
+};
+
+/*!
+ * @brief The conditions on the elements of one scope with the same negation.
+ */
+struct ElementGroup {
+    size_t scope;
+    bool negated;
+    std::vector<ResolvedCondition> conditions;
+};
+
+/*!
+ * @brief A query with all fields resolved.
+ */
+struct ResolvedQuery {
+    std::vector<Scope> scopes;
+    std::vector<ResolvedCondition> save_conditions;
+    std::vector<ElementGroup> groups;
+
+    const FieldDescriptor *count_field = nullptr;
+
+    /*!
+     * @brief Scope of count_field, -1 for a top level field.
+     */
+    int count_scope = -1;
+
+    /*!
+     * @brief The top level fields read from the payload scan.
+     */
+    std::vector<const FieldDescriptor *> summary_fields;
+};
+
+/*!
+ * @brief Checks if a field holds a single value that can be compared.
+ */
+bool isComparable(const FieldDescriptor *field) {
+    return !field->is_repeated() && field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE;
+}
+
+/*!
+ * @brief Returns the index of the scope named name, adding it if it is a repeated message of the save.
+ *
+ * @return The index of the scope, -1 if there is no repeated message with this name.
+ */
+int findScope(const std::string &name, std::vector<Scope> *scopes) {
+    for (size_t i = 0; i < scopes->size(); ++i) {
+        if ((*scopes)[i].name == name) {
+            return (int) i;
+        }
+    }
+
+    const google::protobuf::Descriptor *save = WillowTwoPlayerSaveGame::descriptor();
+    const FieldDescriptor *parent = nullptr;
+    const FieldDescriptor *field = save->FindFieldByName(name);
+    if (field == nullptr) {
+        // The missions are split by playthrough, they are queried as one list.
+        parent = save->FindFieldByName("MissionPlaythroughs");
+        field = parent->message_type()->FindFieldByName(name);
+    }
+    if (field == nullptr || !field->is_repeated() || field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+        return -1;
+    }
+    scopes->push_back({name, parent, field});
+    return (int) scopes->size() - 1;
+}
+
+/*!
+ * @brief Finds a field by its query name.
+ *
+ * @param[out] scope The scope of the field, -1 for a top level field.
+ * @return The field, nullptr if there is none or it can not be compared.
+ */
+const FieldDescriptor *findField(const std::string &name, std::vector<Scope> *scopes, int *scope) {
+    const FieldDescriptor *field = nullptr;
+    const size_t dot = name.find('.');
+    if (dot == std::string::npos) {
+        *scope = -1;
+        field = WillowTwoPlayerSaveGame::descriptor()->FindFieldByName(name);
+    } else {
+        *scope = findScope(name.substr(0, dot), scopes);
+        if (*scope >= 0) {
+            field = (*scopes)[*scope].field->message_type()->FindFieldByName(name.substr(dot + 1));
+        }
+    }
+    return field != nullptr && isComparable(field) ? field : nullptr;
+}
+
+/*!
+ * @brief Converts the value of a condition to the type of its field.
+ *
+ * @return false if the value is not valid for the field.
+ */
+bool resolveValue(const FieldDescriptor *field, const Condition &condition, FieldValue *value) {
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_STRING:
+            value->is_text = true;
+            value->text = condition.value;
+            return true;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            value->is_text = true;
+            value->text = condition.value;
+            return condition.comparison == Comparison::contains ||
+                   field->enum_type()->FindValueByName(condition.value) != nullptr;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            if (condition.value == "true" || condition.value == "1") {
+                value->number = 1;
+            } else if (condition.value == "false" || condition.value == "0") {
+                value->number = 0;
+            } else {
+                return false;
+            }
+            return condition.comparison != Comparison::contains;
+        default: {
+            char *end = nullptr;
+            value->number = std::strtod(condition.value.c_str(), &end);
+            return !condition.value.empty() && *end == '\0' && condition.comparison != Comparison::contains;
+        }
+    }
+}
+
+/*!
+ * @brief Resolves the fields of a query.
+ *
+ * @return false if a field is unknown or a value does not fit its field.
+ */
+bool resolveQuery(const SaveQuery &query, ResolvedQuery *resolved) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    for (const Condition &condition : query.conditions) {
+        int scope;
+        ResolvedCondition resolved_condition = {findField(condition.field, &resolved->scopes, &scope),
+                                                condition.comparison, {}};
+        if (resolved_condition.field == nullptr) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Unknown query field: " << condition.field;
+            return false;
+        }
+        if (!resolveValue(resolved_condition.field, condition, &resolved_condition.value)) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Invalid value for " << condition.field << ": " << condition.value;
+            return false;
+        }
+
+        if (scope < 0) {
+            if (condition.negated) {
+                BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                    << "Only conditions on repeated messages can be negated: " << condition.field;
+                return false;
+            }
+            resolved->save_conditions.push_back(resolved_condition);
+            continue;
+        }
+
+        auto group = std::find_if(resolved->groups.begin(), resolved->groups.end(), [&](const ElementGroup &group) {
+            return group.scope == (size_t) scope && group.negated == condition.negated;
+        });
+        if (group == resolved->groups.end()) {
+            resolved->groups.push_back({(size_t) scope, condition.negated, {}});
+            group = resolved->groups.end() - 1;
+        }
+        group->conditions.push_back(resolved_condition);
+    }
+
+    if (!query.count_by.empty()) {
+        resolved->count_field = findField(query.count_by, &resolved->scopes, &resolved->count_scope);
+        if (resolved->count_field == nullptr) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Unknown query field: " << query.count_by;
+            return false;
+        }
+    }
+
+    for (const ResolvedCondition &condition : resolved->save_conditions) {
+        resolved->summary_fields.push_back(condition.field);
+    }
+    if (resolved->count_field != nullptr && resolved->count_scope < 0) {
+        resolved->summary_fields.push_back(resolved->count_field);
+    }
+    return true;
+}
+
+/*!
+ * @brief Checks if a query needs more than the top level fields of a save.
+ */
+bool needsParse(const ResolvedQuery &query) {
+    return !query.groups.empty() || (query.count_field != nullptr && query.count_scope >= 0);
+}
+
+/*!
+ * @brief Returns the default of a field, used if it is missing from the payload.
+ */
+FieldValue defaultValue(const FieldDescriptor *field) {
+    FieldValue value;
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            value.number = field->default_value_int32();
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            value.number = (double) field->default_value_int64();
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            value.number = field->default_value_uint32();
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            value.number = (double) field->default_value_uint64();
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            value.number = field->default_value_float();
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            value.number = field->default_value_double();
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            value.number = field->default_value_bool() ? 1 : 0;
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            value.is_text = true;
+            value.text = field->default_value_enum()->name();
+            break;
+        default:
+            value.is_text = true;
+            value.text = field->default_value_string();
+            break;
+    }
+    return value;
+}
+
+/*!
+ * @brief Decodes a top level field from its span in the payload.
+ *
+ * @throw std::out_of_range If the value exceeds the payload.
+ * @throw std::invalid_argument If the wire type does not match the field.
+ */
+FieldValue spanValue(const uint8_t *payload, const D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan &span,
+                     const FieldDescriptor *field) noexcept(false) {
+    using D4v3::Borderlands::Borderlands2::WireFormat::WireType;
+    using D4v3::Borderlands::Common::Streams::Endian;
+
+    D4v3::Borderlands::Common::Streams::ByteReader reader(payload + span.value_offset, span.end - span.value_offset);
+    FieldValue value;
+    switch (field->type()) {
+        case FieldDescriptor::TYPE_STRING:
+        case FieldDescriptor::TYPE_BYTES:
+            if (span.wire_type != WireType::length_delimited) {
+                break;
+            }
+            value.is_text = true;
+            value.text.assign(reinterpret_cast<const char *>(payload + span.value_offset), span.end - span.value_offset);
+            return value;
+        case FieldDescriptor::TYPE_FLOAT:
+            if (span.wire_type != WireType::fixed32) {
+                break;
+            }
+            {
+                const auto bits = reader.read<uint32_t, Endian::little_endian>();
+                float number;
+                std::memcpy(&number, &bits, sizeof(number));
+                value.number = number;
+            }
+            return value;
+        case FieldDescriptor::TYPE_DOUBLE:
+            if (span.wire_type != WireType::fixed64) {
+                break;
+            }
+            {
+                const auto bits = reader.read<uint64_t, Endian::little_endian>();
+                std::memcpy(&value.number, &bits, sizeof(value.number));
+            }
+            return value;
+        case FieldDescriptor::TYPE_FIXED32:
+        case FieldDescriptor::TYPE_SFIXED32:
+        case FieldDescriptor::TYPE_FIXED64:
+        case FieldDescriptor::TYPE_SFIXED64:
+        case FieldDescriptor::TYPE_GROUP:
+        case FieldDescriptor::TYPE_MESSAGE:
+            break;
+        default: {
+            if (span.wire_type != WireType::varint) {
+                break;
+            }
+            const uint64_t raw = reader.read_varint();
+            switch (field->type()) {
+                case FieldDescriptor::TYPE_SINT32:
+                case FieldDescriptor::TYPE_SINT64:
+                    value.number = (double) ((int64_t) (raw >> 1u) ^ -(int64_t) (raw & 1u));
+                    break;
+                case FieldDescriptor::TYPE_UINT32:
+                case FieldDescriptor::TYPE_UINT64:
+                    value.number = (double) raw;
+                    break;
+                case FieldDescriptor::TYPE_INT32:
+                    value.number = (int32_t) raw;
+                    break;
+                case FieldDescriptor::TYPE_ENUM: {
+                    const auto *enum_value = field->enum_type()->FindValueByNumber((int) raw);
+                    value.is_text = true;
+                    value.text = enum_value != nullptr ? enum_value->name() : std::to_string((int32_t) raw);
+                    break;
+                }
+                default:
+                    value.number = (double) (int64_t) raw;
+                    break;
+            }
+            return value;
+        }
+    }
+    throw std::invalid_argument("Unexpected wire type for " + field->full_name() + "!");
+}
+
+/*!
+ * @brief Reads the summary fields of a query from the top level fields of a payload.
+ *
+ * @param[out] values The values in the order of summary_fields.
+ * @return false if the payload is malformed.
+ */
+bool readSummary(const std::vector<uint8_t> &payload, const ResolvedQuery &query, std::vector<FieldValue> *values) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    values->clear();
+    for (const FieldDescriptor *field : query.summary_fields) {
+        values->push_back(defaultValue(field));
+    }
+    if (query.summary_fields.empty()) {
+        return true;
+    }
+
+    std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> spans;
+    if (!D4v3::Borderlands::Borderlands2::WireFormat::indexTopLevelFields(payload.data(), payload.size(), &spans)) {
+        return false;
+    }
+    try {
+        // A field that occurs more than once keeps its last value, as the protobuf parser does.
+        for (const auto &span : spans) {
+            for (size_t i = 0; i < query.summary_fields.size(); ++i) {
+                if ((uint32_t) query.summary_fields[i]->number() == span.number) {
+                    (*values)[i] = spanValue(payload.data(), span, query.summary_fields[i]);
+                }
+            }
+        }
+    } catch (std::exception &ex) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Malformed summary field! " << ex.what();
+        return false;
+    }
+    return true;
+}
+
+/*!
+ * @brief Reads a field of a parsed message.
+ */
+FieldValue messageValue(const Message &message, const FieldDescriptor *field) {
+    const Reflection *reflection = message.GetReflection();
+    FieldValue value;
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:
+            value.number = reflection->GetInt32(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_INT64:
+            value.number = (double) reflection->GetInt64(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT32:
+            value.number = reflection->GetUInt32(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_UINT64:
+            value.number = (double) reflection->GetUInt64(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            value.number = reflection->GetFloat(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            value.number = reflection->GetDouble(message, field);
+            break;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            value.number = reflection->GetBool(message, field) ? 1 : 0;
+            break;
+        case FieldDescriptor::CPPTYPE_ENUM:
+            value.is_text = true;
+            value.text = reflection->GetEnum(message, field)->name();
+            break;
+        default:
+            value.is_text = true;
+            value.text = reflection->GetString(message, field);
+            break;
+    }
+    return value;
+}
+
+bool compareValue(const FieldValue &value, const ResolvedCondition &condition) {
+    if (condition.comparison == Comparison::contains) {
+        return value.text.find(condition.value.text) != std::string::npos;
+    }
+
+    int order;
+    if (value.is_text) {
+        order = value.text.compare(condition.value.text);
+    } else {
+        order = value.number < condition.value.number ? -1 : (value.number > condition.value.number ? 1 : 0);
+    }
+    switch (condition.comparison) {
+        case Comparison::equal:
+            return order == 0;
+        case Comparison::not_equal:
+            return order != 0;
+        case Comparison::less:
+            return order < 0;
+        case Comparison::less_equal:
+            return order <= 0;
+        case Comparison::greater:
+            return order > 0;
+        case Comparison::greater_equal:
+            return order >= 0;
+        default:
+            return false;
+    }
+}
+
+/*!
+ * @brief Checks if an element passes all conditions of a group.
+ */
+bool passesConditions(const Message &element, const std::vector<ResolvedCondition> &conditions) {
+    for (const ResolvedCondition &condition : conditions) {
+        if (!compareValue(messageValue(element, condition.field), condition)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * @brief Calls visit for every element of a scope until it returns false.
+ */
+template<typename Visitor>
+void forEachElement(const WillowTwoPlayerSaveGame &save_game, const Scope &scope, Visitor visit) {
+    const Reflection *reflection = save_game.GetReflection();
+    if (scope.parent == nullptr) {
+        const int size = reflection->FieldSize(save_game, scope.field);
+        for (int i = 0; i < size; ++i) {
+            if (!visit(reflection->GetRepeatedMessage(save_game, scope.field, i))) {
+                return;
+            }
+        }
+        return;
+    }
+
+    const int parents = reflection->FieldSize(save_game, scope.parent);
+    for (int p = 0; p < parents; ++p) {
+        const Message &parent = reflection->GetRepeatedMessage(save_game, scope.parent, p);
+        const Reflection *parent_reflection = parent.GetReflection();
+        const int size = parent_reflection->FieldSize(parent, scope.field);
+        for (int i = 0; i < size; ++i) {
+            if (!visit(parent_reflection->GetRepeatedMessage(parent, scope.field, i))) {
+                return;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief Formats a value as a key of the counts.
+ */
+std::string countKey(const FieldValue &value, const FieldDescriptor *field) {
+    if (value.is_text) {
+        return value.text;
+    }
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_BOOL) {
+        return value.number != 0 ? "true" : "false";
+    }
+    if (std::floor(value.number) == value.number && std::fabs(value.number) < 1e15) {
+        return std::to_string((int64_t) value.number);
+    }
+    std::ostringstream stream;
+    stream << value.number;
+    return stream.str();
+}
+
+/*!
+ * @brief Checks the element groups of a query on a parsed save and counts its elements.
+ *
+ * @return true if the save matches.
+ */
+bool matchElements(const WillowTwoPlayerSaveGame &save_game, const ResolvedQuery &query,
+                   std::map<std::string, uint64_t> *counts) {
+    const ElementGroup *count_group = nullptr;
+    for (const ElementGroup &group : query.groups) {
+        bool found = false;
+        forEachElement(save_game, query.scopes[group.scope], [&](const Message &element) {
+            found = passesConditions(element, group.conditions);
+            return !found;
+        });
+        if (found == group.negated) {
+            return false;
+        }
+        if (!group.negated && (int) group.scope == query.count_scope) {
+            count_group = &group;
+        }
+    }
+
+    if (query.count_field != nullptr && query.count_scope >= 0) {
+        forEachElement(save_game, query.scopes[query.count_scope], [&](const Message &element) {
+            if (count_group == nullptr || passesConditions(element, count_group->conditions)) {
+                ++(*counts)[countKey(messageValue(element, query.count_field), query.count_field)];
+            }
+            return true;
+        });
+    }
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Query::parseQuery(const std::vector<std::string> &terms,
+                                                   SaveQuery *query) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    static const std::vector<std::pair<std::string, Comparison>> operators = {
+            {"!=", Comparison::not_equal},
+            {"<=", Comparison::less_equal},
+            {">=", Comparison::greater_equal},
+            {"=",  Comparison::equal},
+            {"<",  Comparison::less},
+            {">",  Comparison::greater},
+            {"~",  Comparison::contains},
+    };
+
+    *query = SaveQuery();
+    for (const std::string &term : terms) {
+        if (term.compare(0, 6, "count:") == 0) {
+            query->count_by = term.substr(6);
+            continue;
+        }
+
+        Condition condition;
+        condition.negated = !term.empty() && term[0] == '!';
+        const size_t name_begin = condition.negated ? 1 : 0;
+        const size_t name_end = term.find_first_of("!=<>~", name_begin);
+        if (name_end == std::string::npos || name_end == name_begin) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Malformed query term: " << term;
+            return false;
+        }
+        condition.field = term.substr(name_begin, name_end - name_begin);
+
+        auto op = std::find_if(operators.begin(), operators.end(), [&](const std::pair<std::string, Comparison> &op) {
+            return term.compare(name_end, op.first.size(), op.first) == 0;
+        });
+        if (op == operators.end()) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                << "Malformed query term: " << term;
+            return false;
+        }
+        condition.comparison = op->second;
+        condition.value = term.substr(name_end + op->first.size());
+        query->conditions.push_back(condition);
+    }
+
+    ResolvedQuery resolved;
+    return resolveQuery(*query, &resolved);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Query::runQuery(const std::vector<std::string> &paths, const SaveQuery &query,
+                                                 QueryResult *result, unsigned int threads) noexcept(false) {
+    *result = QueryResult();
+    ResolvedQuery resolved;
+    if (!resolveQuery(query, &resolved)) {
+        return false;
+    }
+    const bool parse = needsParse(resolved);
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::max(1u, std::min<unsigned int>(threads, (unsigned int) paths.size()));
+
+    std::vector<char> matched(paths.size(), 0);
+    std::atomic<size_t> next_path(0);
+    std::atomic<size_t> parsed(0);
+    std::atomic<size_t> failed(0);
+    std::mutex counts_mutex;
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threads; ++i) {
+        workers.emplace_back([&]() {
+            google::protobuf::Arena arena;
+            std::vector<uint8_t> payload;
+            std::vector<FieldValue> summary;
+            std::map<std::string, uint64_t> counts;
+            std::map<std::string, uint64_t> save_counts;
+
+            for (size_t index = next_path++; index < paths.size(); index = next_path++) {
+                // A save that throws only counts as failed, an exception leaving the thread would terminate.
+                try {
+                    if (!readSave(paths[index], nullptr, &payload) || !readSummary(payload, resolved, &summary)) {
+                        ++failed;
+                        continue;
+                    }
+
+                    bool match = true;
+                    for (size_t c = 0; c < resolved.save_conditions.size() && match; ++c) {
+                        match = compareValue(summary[c], resolved.save_conditions[c]);
+                    }
+                    if (!match) {
+                        continue;
+                    }
+
+                    if (parse) {
+                        auto *save_game = google::protobuf::Arena::CreateMessage<WillowTwoPlayerSaveGame>(&arena);
+                        if (!save_game->ParseFromArray(payload.data(), (int) payload.size())) {
+                            ++failed;
+                            arena.Reset();
+                            continue;
+                        }
+                        ++parsed;
+                        // The counts of a save are only added once it was matched completely.
+                        save_counts.clear();
+                        match = matchElements(*save_game, resolved, &save_counts);
+                        arena.Reset();
+                        for (const auto &count : save_counts) {
+                            counts[count.first] += count.second;
+                        }
+                    }
+                    if (match && resolved.count_field != nullptr && resolved.count_scope < 0) {
+                        ++counts[countKey(summary.back(), resolved.count_field)];
+                    }
+                    matched[index] = match;
+                } catch (std::exception &ex) {
+                    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+                    BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+                        << "Failed to query save " << paths[index] << "! " << ex.what();
+                    ++failed;
+                    arena.Reset();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(counts_mutex);
+            for (const auto &count : counts) {
+                result->counts[count.first] += count.second;
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (matched[i]) {
+            result->matches.push_back(paths[i]);
+        }
+    }
+    result->parsed = parsed;
+    result->failed = failed;
+    return true;
+}
@@ -0,0 +1,106 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/serial.hpp"
+
+#include <algorithm>
+
+#include "common/common.hpp"
+
+/*!
+ * @brief Size of the version byte and the seed at the start of every serial.
+ */
+constexpr size_t SERIAL_HEADER_SIZE = 5;
+
+/*!
+ * @brief Size of the checksum at the start of the scrambled data.
+ */
+constexpr size_t SERIAL_CHECKSUM_SIZE = 2;
+
+/*!
+ * @brief XORs data with the key stream derived from the seed, applying it twice restores the data.
+ */
+void xorSerialData(uint8_t *data, size_t size, uint32_t seed) {
+    uint32_t key = (uint32_t) (((int32_t) seed) >> 5);
+    for (size_t i = 0; i < size; ++i) {
+        key = (uint32_t) (((uint64_t) key * 0x10A860C1u) % 0xFFFFFFFBu);
+        data[i] ^= (uint8_t) (key & 0xFFu);
+    }
+}
+
+/*!
+ * @brief Calculates the checksum of a descrambled serial.
+ *
+ * @details The checksum is the CRC32 over the serial padded to 40 bytes with 0xFF, the checksum bytes
+ *  themselves count as 0xFF. Both halves of the CRC are folded into 16 bit.
+ */
+uint16_t calculateSerialChecksum(const std::vector<uint8_t> &serial) {
+    uint8_t padded[D4v3::Borderlands::Borderlands2::Serial::serial_length];
+    std::fill(std::begin(padded), std::end(padded), 0xFF);
+    std::copy_n(serial.begin(), std::min(serial.size(), sizeof(padded)), padded);
+    padded[SERIAL_HEADER_SIZE] = 0xFF;
+    padded[SERIAL_HEADER_SIZE + 1] = 0xFF;
+
+    uint32_t crc = D4v3::Borderlands::Common::Checksum::crc32(padded, sizeof(padded));
+    return (uint16_t) ((crc >> 16u) ^ (crc & 0xFFFFu));
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Serial::decodeSerial(const std::string &serial,
+                                                      DecodedSerial *decoded) noexcept(false) {
+    if (serial.size() < SERIAL_HEADER_SIZE + SERIAL_CHECKSUM_SIZE || serial.size() > serial_length) {
+        return false;
+    }
+
+    std::vector<uint8_t> data(serial.begin(), serial.end());
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data.data(), SERIAL_HEADER_SIZE);
+
+    uint8_t header = reader.read<uint8_t, Common::Streams::big_endian>();
+    decoded->is_weapon = (header & 0x80u) != 0;
+    decoded->version = (uint8_t) (header & 0x7Fu);
+    decoded->seed = reader.read<uint32_t, Common::Streams::big_endian>();
+
+    if (decoded->version != serial_version) {
+        return false;
+    }
+
+    // Serials with seed 0 are stored without scrambling.
+    if (decoded->seed != 0) {
+        uint8_t *body = data.data() + SERIAL_HEADER_SIZE;
+        size_t body_size = data.size() - SERIAL_HEADER_SIZE;
+        xorSerialData(body, body_size, decoded->seed);
+        std::rotate(body, body + (body_size - (decoded->seed % 32u) % body_size), body + body_size);
+    }
+
+    decoded->checksum = (uint16_t) ((data[SERIAL_HEADER_SIZE] << 8u) | data[SERIAL_HEADER_SIZE + 1]);
+    decoded->asset_data.assign(data.begin() + SERIAL_HEADER_SIZE + SERIAL_CHECKSUM_SIZE, data.end());
+    decoded->asset_library_set_id = decoded->asset_data.empty() ? 0 : decoded->asset_data.front();
+
+    return decoded->checksum == calculateSerialChecksum(data);
+}
+
+std::string BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::Serial::encodeSerial(const DecodedSerial &decoded) noexcept(false) {
+    std::vector<uint8_t> data;
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&data);
+
+    writer.write<uint8_t, Common::Streams::big_endian>(
+            (uint8_t) ((decoded.version & 0x7Fu) | (decoded.is_weapon ? 0x80u : 0x00u)));
+    writer.write<uint32_t, Common::Streams::big_endian>(decoded.seed);
+    size_t checksum_offset = writer.reserve<uint16_t>();
+    writer.write_bytes(decoded.asset_data.data(),
+                       std::min(decoded.asset_data.size(),
+                                serial_length - SERIAL_HEADER_SIZE - SERIAL_CHECKSUM_SIZE));
+
+    writer.patch<uint16_t, Common::Streams::big_endian>(checksum_offset, calculateSerialChecksum(data));
+
+    if (decoded.seed != 0) {
+        uint8_t *body = data.data() + SERIAL_HEADER_SIZE;
+        size_t body_size = data.size() - SERIAL_HEADER_SIZE;
+        std::rotate(body, body + (decoded.seed % 32u) % body_size, body + body_size);
+        xorSerialData(body, body_size, decoded.seed);
+    }
+
+    return std::string(data.begin(), data.end());
+}
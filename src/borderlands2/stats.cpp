@@ -0,0 +1,142 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/stats.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <common/common.hpp>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+/*!
+ * @brief Size of the version and size fields in front of the entries.
+ */
+constexpr size_t STATS_HEADER_SIZE = 8;
+
+/*!
+ * @brief The type byte of an entry holding an int32.
+ */
+constexpr uint8_t STAT_TYPE_INT32 = 1;
+
+/*!
+ * @brief Size of an entry: id, type, value and the five trailing bytes.
+ */
+constexpr size_t STAT_ENTRY_SIZE = 2 + 1 + 4 + 5;
+
+/*!
+ * @brief Offset of the value in an entry.
+ */
+constexpr size_t STAT_VALUE_OFFSET = 3;
+
+D4v3::Borderlands::Borderlands2::Stats::StatsView::StatsView(const std::string &blob) noexcept
+        : blob(&blob), writable_blob(nullptr), indexed(false), well_formed(false) {
+}
+
+D4v3::Borderlands::Borderlands2::Stats::StatsView::StatsView(std::string *blob) noexcept
+        : blob(blob), writable_blob(blob), indexed(false), well_formed(false) {
+}
+
+bool D4v3::Borderlands::Borderlands2::Stats::StatsView::valid() const noexcept(false) {
+    return index();
+}
+
+size_t D4v3::Borderlands::Borderlands2::Stats::StatsView::size() const noexcept(false) {
+    return index() ? stat_ids.size() : 0;
+}
+
+std::vector<uint16_t> D4v3::Borderlands::Borderlands2::Stats::StatsView::ids() const noexcept(false) {
+    return index() ? stat_ids : std::vector<uint16_t>();
+}
+
+bool D4v3::Borderlands::Borderlands2::Stats::StatsView::get(uint16_t id, int32_t *value) const noexcept(false) {
+    if (!index()) {
+        return false;
+    }
+    auto offset = value_offsets.find(id);
+    if (offset == value_offsets.end()) {
+        return false;
+    }
+
+    D4v3::Borderlands::Common::Streams::ByteReader reader(blob->data() + offset->second, sizeof(int32_t));
+    *value = reader.read<int32_t, D4v3::Borderlands::Common::Streams::Endian::little_endian>();
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::Stats::StatsView::set(uint16_t id, int32_t value) noexcept(false) {
+    if (writable_blob == nullptr || !index()) {
+        return false;
+    }
+    auto offset = value_offsets.find(id);
+    if (offset == value_offsets.end()) {
+        return false;
+    }
+
+    const int32_t little_endian =
+            D4v3::Borderlands::Common::Streams::convert_endian<D4v3::Borderlands::Common::Streams::Endian::little_endian>(value);
+    std::memcpy(&(*writable_blob)[offset->second], &little_endian, sizeof(little_endian));
+    return true;
+}
+
+bool D4v3::Borderlands::Borderlands2::Stats::StatsView::index() const noexcept(false) {
+    using D4v3::Borderlands::Common::Streams::Endian;
+
+    if (indexed) {
+        return well_formed;
+    }
+    indexed = true;
+
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+    D4v3::Borderlands::Common::Streams::ByteReader reader(blob->data(), blob->size());
+    try {
+        reader.read<uint32_t, Endian::little_endian>();
+        const auto size = reader.read<uint32_t, Endian::little_endian>();
+        if (size != blob->size() - STATS_HEADER_SIZE) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+                << "StatsData size " << size << " does not match the blob size " << blob->size() << "!";
+            return false;
+        }
+
+        const auto count = reader.read<uint16_t, Endian::little_endian>();
+        if (reader.remaining() != count * STAT_ENTRY_SIZE) {
+            BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+                << "StatsData holds " << reader.remaining() << " bytes for " << count << " stats!";
+            return false;
+        }
+
+        // Only the id and type of every entry are read, the values stay untouched until they are requested.
+        stat_ids.reserve(count);
+        value_offsets.reserve(count);
+        for (uint16_t i = 0; i < count; ++i) {
+            const auto id = reader.read<uint16_t, Endian::little_endian>();
+            const auto type = reader.read<uint8_t, Endian::little_endian>();
+            if (type != STAT_TYPE_INT32) {
+                BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+                    << "Unknown type " << (int) type << " of stat " << id << "!";
+                stat_ids.clear();
+                value_offsets.clear();
+                return false;
+            }
+            stat_ids.push_back(id);
+            value_offsets.emplace(id, reader.position());
+            reader.skip(STAT_ENTRY_SIZE - STAT_VALUE_OFFSET);
+        }
+    } catch (std::out_of_range &ex) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::warning)
+            << "StatsData is truncated! " << ex.what();
+        stat_ids.clear();
+        value_offsets.clear();
+        return false;
+    }
+
+    well_formed = true;
+    return true;
+}
@@ -0,0 +1,122 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "borderlands2/wire_format.hpp"
+
+#define BOOST_LOG_DYN_LINK 1
+
+#include <boost/log/core.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <common/common.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(lib_saveeditor_logger, boost::log::trivial::logger);
+
+/*!
+ * @brief Indexes the fields of one serialized message.
+ *
+ * @param[in] data The whole serialized save, offsets are relative to it.
+ * @param[in] begin Offset of the first byte of the message.
+ * @param[in] end Offset behind the last byte of the message.
+ * @param[in] descriptor The type of the message, used to find nested messages.
+ * @param[in] parent Index of the span of the field holding the message.
+ * @param[out] index The list the spans are appended to.
+ *
+ * @throw std::out_of_range If a field exceeds the message.
+ * @throw std::invalid_argument If the message contains malformed varints or unsupported wire types.
+ */
+void indexMessage(const uint8_t *data, size_t begin, size_t end, const google::protobuf::Descriptor *descriptor,
+                  int32_t parent, std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> *index) noexcept(false) {
+    using D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan;
+    using D4v3::Borderlands::Borderlands2::WireFormat::WireType;
+
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data + begin, end - begin);
+    while (reader.remaining() > 0) {
+        FieldSpan span = {};
+        span.offset = begin + reader.position();
+        span.parent = parent;
+
+        uint64_t tag = reader.read_varint();
+        span.number = (uint32_t) (tag >> 3u);
+        span.wire_type = (WireType) (tag & 0x07u);
+
+        switch (span.wire_type) {
+            case WireType::varint:
+                span.value_offset = begin + reader.position();
+                reader.read_varint();
+                span.end = begin + reader.position();
+                break;
+            case WireType::fixed64:
+                span.value_offset = begin + reader.position();
+                reader.skip(8);
+                span.end = begin + reader.position();
+                break;
+            case WireType::fixed32:
+                span.value_offset = begin + reader.position();
+                reader.skip(4);
+                span.end = begin + reader.position();
+                break;
+            case WireType::length_delimited: {
+                auto length = (size_t) reader.read_varint();
+                span.value_offset = begin + reader.position();
+                reader.skip(length);
+                span.end = begin + reader.position();
+                break;
+            }
+            default:
+                throw std::invalid_argument("Unsupported wire type " + std::to_string((int) span.wire_type) + "!");
+        }
+
+        index->push_back(span);
+
+        const google::protobuf::FieldDescriptor *field =
+                descriptor != nullptr ? descriptor->FindFieldByNumber((int) span.number) : nullptr;
+        if (field != nullptr && span.wire_type == WireType::length_delimited &&
+            field->type() == google::protobuf::FieldDescriptor::TYPE_MESSAGE) {
+            indexMessage(data, span.value_offset, span.end, field->message_type(), (int32_t) (index->size() - 1),
+                         index);
+        }
+    }
+}
+
+/*!
+ * @brief Indexes a serialized save, logging malformed data.
+ *
+ * @param[in] descriptor The type used to find nested messages, nullptr to index only the top level fields.
+ */
+bool indexFields(const uint8_t *data, size_t size, const google::protobuf::Descriptor *descriptor,
+                 std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> *index) noexcept(false) {
+    boost::log::trivial::logger &logger = lib_saveeditor_logger::get();
+
+    index->clear();
+    try {
+        indexMessage(data, 0, size, descriptor, -1, index);
+    } catch (std::out_of_range &ex) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Field exceeds its message! " << ex.what();
+        index->clear();
+        return false;
+    } catch (std::invalid_argument &ex) {
+        BOOST_LOG_SEV(logger.get(), boost::log::trivial::severity_level::error)
+            << "Malformed field! " << ex.what();
+        index->clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(const uint8_t *data, size_t size,
+                                                             std::vector<FieldSpan> *index) noexcept(false) {
+    return indexFields(data, size, WillowTwoPlayerSaveGame::descriptor(), index);
+}
+
+bool BORDERLANDS2_SAVE_EDITOR_API
+D4v3::Borderlands::Borderlands2::WireFormat::indexTopLevelFields(const uint8_t *data, size_t size,
+                                                                 std::vector<FieldSpan> *index) noexcept(false) {
+    return indexFields(data, size, nullptr, index);
+}
@@ -0,0 +1,62 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include "common/common.hpp"
+
+/*!
+ * @brief Lookup tables for the slicing-by-8 CRC32 kernel.
+ *
+ * @details Table 0 is the classic byte wise table of the reflected polynomial 0xEDB88320. Table k holds the
+ *  checksum of a byte followed by k zero bytes, so 8 table lookups advance the checksum by 8 bytes.
+ */
+struct Crc32Tables {
+    uint32_t table[8][256];
+
+    Crc32Tables() noexcept {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1u) ? (crc >> 1u) ^ 0xEDB88320u : crc >> 1u;
+            }
+            table[0][i] = crc;
+        }
+
+        for (uint32_t i = 0; i < 256; ++i) {
+            for (int slice = 1; slice < 8; ++slice) {
+                table[slice][i] = (table[slice - 1][i] >> 8u) ^ table[0][table[slice - 1][i] & 0xFFu];
+            }
+        }
+    }
+};
+
+static const Crc32Tables crc32_tables;
+
+uint32_t BORDERLANDS_COMMON_API D4v3::Borderlands::Common::Checksum::crc32(const uint8_t *data, size_t size,
+                                                                          uint32_t crc) noexcept {
+    const auto& table = crc32_tables.table;
+    crc = ~crc;
+
+    while (size >= 8) {
+        uint32_t one;
+        uint32_t two;
+        std::memcpy(&one, data, 4);
+        std::memcpy(&two, data + 4, 4);
+        one = Streams::convert_endian<Streams::little_endian>(one) ^ crc;
+        two = Streams::convert_endian<Streams::little_endian>(two);
+
+        crc = table[7][one & 0xFFu] ^ table[6][(one >> 8u) & 0xFFu] ^
+              table[5][(one >> 16u) & 0xFFu] ^ table[4][one >> 24u] ^
+              table[3][two & 0xFFu] ^ table[2][(two >> 8u) & 0xFFu] ^
+              table[1][(two >> 16u) & 0xFFu] ^ table[0][two >> 24u];
+
+        data += 8;
+        size -= 8;
+    }
+
+    while (size-- > 0) {
+        crc = (crc >> 8u) ^ table[0][(crc ^ *data++) & 0xFFu];
+    }
+
+    return ~crc;
+}
@@ -2,101 +2,277 @@
 // Created by David Oberacker on 2019-07-31.
 //
 
+#include <algorithm>
 #include <string>
-#include <map>
-#include <queue>
-#include <boost/dynamic_bitset.hpp>
 
 #include "common/common.hpp"
 
-struct Node
-{
-    uint8_t Symbol;
-    bool IsLeaf;
-    int64_t Left;
-    int64_t Right;
+/*!
+ * @brief The number of branch nodes of a tree over 256 symbols.
+ */
+constexpr uint16_t MAX_BRANCHES = 255;
+
+/*!
+ * @brief Marks a node reference as a leaf, the low 8 bits are its symbol. Otherwise a reference is a branch index.
+ */
+constexpr uint16_t LEAF_FLAG = 0x100;
+
+/*!
+ * @brief The number of bits decoded with one lookup.
+ */
+constexpr uint32_t LOOKUP_BITS = 10;
+
+/*!
+ * @brief Position of the code length in a lookup entry, the low bits hold the node reference.
+ */
+constexpr uint32_t LOOKUP_LENGTH_SHIFT = 12;
+
+/*!
+ * @brief The Huffman tree as a flat array plus a table decoding the first LOOKUP_BITS bits of a code at once.
+ *
+ * @details The branches take 1 KB and the table 2 KB, so both stay in the L1 cache while decoding. A table entry
+ *  holds the reference of the leaf a code prefix ends in, or of the branch reached after LOOKUP_BITS bits, and
+ *  the number of bits it consumes.
+ */
+struct FlatTree {
+    uint16_t root;
+    uint16_t branches[MAX_BRANCHES][2];
+    uint16_t lookup[1u << LOOKUP_BITS];
 };
 
-uint8_t decodeByte(boost::dynamic_bitset<> data, int64_t* offset) {
-    uint8_t value = 0;
-    for (int i = 7; i >= 0; --i)
+/*!
+ * @brief Reads bits most significant bit first through a 64 bit buffer.
+ *
+ * @details The end of the input is only checked when the buffer runs empty and is refilled, not for every bit,
+ *  so the checked decoder runs as fast as an unchecked one.
+ */
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size) : begin(data), next(data), end(data + size), bits(0), count(0) {}
+
+    /*!
+     * @brief Reads one bit.
+     *
+     * @return false if the input is exhausted, else true.
+     */
+    bool readBit(bool* bit)
     {
-        uint8_t v = data[(*offset)++] ? 1 : 0;
-        value |= (uint8_t)(v << (unsigned int) i);
+        if (count == 0 && !refill())
+        {
+            return false;
+        }
+        *bit = (bits >> 63u) != 0;
+        bits <<= 1u;
+        --count;
+        return true;
     }
-    return value;
-};
 
-int decodeNode(const boost::dynamic_bitset<>& data, int64_t* offset, Node* tree, int64_t* index)
-{
-    uint32_t current = (*index);
-    (*index)++;
+    /*!
+     * @brief Reads an 8 bit value.
+     *
+     * @return false if the input is exhausted, else true.
+     */
+    bool readByte(uint8_t* value)
+    {
+        *value = 0;
+        for (int i = 0; i < 8; ++i)
+        {
+            bool bit;
+            if (!readBit(&bit))
+            {
+                return false;
+            }
+            *value = (uint8_t) ((*value << 1u) | (bit ? 1u : 0u));
+        }
+        return true;
+    }
 
-    bool isLeaf = data[(*offset)++];
+    /*!
+     * @brief Makes at least count bits available to peek, refilling the buffer if needed.
+     *
+     * @return false if the input has fewer bits left, else true.
+     */
+    bool ensure(uint32_t required)
+    {
+        if (count < required)
+        {
+            refill();
+        }
+        return count >= required;
+    }
 
-    if (isLeaf)
+    /*!
+     * @brief Returns the next count bits without consuming them, ensure has to be called first.
+     */
+    uint32_t peek(uint32_t length) const
     {
-        uint8_t value = decodeByte(data, offset);
-        tree[current].Left = -1;
-        tree[current].Right = -1;
-        tree[current].IsLeaf = true;
-        tree[current].Symbol = value;
+        return (uint32_t) (bits >> (64u - length));
     }
-    else
+
+    /*!
+     * @brief Consumes bits returned by peek.
+     */
+    void skip(uint32_t length)
     {
-        tree[current].Left = decodeNode(data, offset, tree, index);
-        tree[current].Right = decodeNode(data, offset, tree, index);
-        tree[current].IsLeaf = false;
+        bits <<= length;
+        count -= length;
     }
 
-    return current;
-}
+    /*!
+     * @brief Returns the number of bits read so far.
+     */
+    uint64_t position() const
+    {
+        return (uint64_t) (next - begin) * 8 - count;
+    }
 
- void convertBytesToBits(const char* data, uint32_t data_size, boost::dynamic_bitset<>* bit_map)
-{
-    for (int i = 0, o = 0; i < data_size; i++)
+private:
+    /*!
+     * @brief Appends whole bytes to the buffer until it is full or the input ends.
+     *
+     * @return false if no byte was left, else true.
+     */
+    bool refill()
     {
-        for (int j = 7; j >= 0; j--)
+        while (count <= 56 && next < end)
         {
-            bool s = ((data[i] & (1 << j)) != 0);
-            (*bit_map)[o++] = s;
+            bits |= (uint64_t) *next++ << (56u - count);
+            count += 8;
         }
+        return count > 0;
     }
-}
 
+    const uint8_t* begin;
+    const uint8_t* next;
+    const uint8_t* end;
+    uint64_t bits;
+    uint32_t count;
+};
 
+/*!
+ * @brief Reads the serialized tree into a FlatTree and fills its lookup table in the same pass.
+ *
+ * @details The tree is read depth first with an explicit stack of the child slots still to be read, together with
+ *  the code leading to them. A leaf at most LOOKUP_BITS deep fills all table entries starting with its code, a
+ *  branch exactly LOOKUP_BITS deep fills its own entry.
+ *
+ * @return false if the tree has more than MAX_BRANCHES branches or runs past the data, else true.
+ */
+bool readTree(BitReader* reader, FlatTree* tree)
+{
+    struct Pending
+    {
+        uint16_t* slot;
+        uint32_t code;
+        uint32_t depth;
+    };
 
-bool BORDERLANDS_COMMON_API
-D4v3::Borderlands::Common::Huffman::decode(const char *input_array, uint32_t input_size, char *output_array,
-                                           int32_t output_size) noexcept(false) {
-    auto* bitArray = new boost::dynamic_bitset<>(input_size * 8);
-    convertBytesToBits(input_array, input_size, bitArray);
+    // Every branch replaces one pending slot with two.
+    Pending stack[MAX_BRANCHES + 1];
+    size_t top = 0;
+    stack[top++] = {&tree->root, 0, 0};
+    uint16_t branch_count = 0;
 
-    auto* tree = new Node[511];
-    int64_t index = 0;
-    int64_t offset = 0;
+    while (top > 0)
+    {
+        const Pending pending = stack[--top];
 
-    decodeNode(*bitArray, &offset, tree, &index);
+        bool isLeaf;
+        if (!reader->readBit(&isLeaf))
+        {
+            return false;
+        }
 
-    int32_t left = output_size;
+        uint16_t reference;
+        if (isLeaf)
+        {
+            uint8_t symbol;
+            if (!reader->readByte(&symbol))
+            {
+                return false;
+            }
+            reference = (uint16_t) (LEAF_FLAG | symbol);
 
-    uint32_t o = 0;
-    while (left > 0)
-    {
-        Node branch = tree[0];
-        while (!branch.IsLeaf)
+            if (pending.depth <= LOOKUP_BITS)
+            {
+                const uint32_t unused_bits = LOOKUP_BITS - pending.depth;
+                const auto entry = (uint16_t) (reference | (pending.depth << LOOKUP_LENGTH_SHIFT));
+                std::fill_n(&tree->lookup[pending.code << unused_bits], (size_t) 1u << unused_bits, entry);
+            }
+        }
+        else
         {
-            branch = tree[(*bitArray)[offset++] == false ? branch.Left : branch.Right];
+            if (branch_count == MAX_BRANCHES)
+            {
+                return false;
+            }
+            reference = branch_count++;
+
+            if (pending.depth == LOOKUP_BITS)
+            {
+                tree->lookup[pending.code] = (uint16_t) (reference | (LOOKUP_BITS << LOOKUP_LENGTH_SHIFT));
+            }
+
+            // The right child is pushed first, so the left one is read first.
+            stack[top++] = {&tree->branches[reference][1], (pending.code << 1u) | 1u, pending.depth + 1};
+            stack[top++] = {&tree->branches[reference][0], pending.code << 1u, pending.depth + 1};
         }
 
-        output_array[o++] = branch.Symbol;
-        left--;
+        *pending.slot = reference;
     }
 
-    delete[] tree;
-    delete bitArray;
-
     return true;
 }
 
+bool BORDERLANDS_COMMON_API
+D4v3::Borderlands::Common::Huffman::decode(const char *input_array, uint32_t input_size, char *output_array,
+                                           int32_t output_size, uint64_t *error_offset) noexcept(false) {
+    BitReader reader(reinterpret_cast<const uint8_t *>(input_array), input_size);
+    FlatTree tree;
+
+    if (!readTree(&reader, &tree))
+    {
+        if (error_offset != nullptr)
+        {
+            *error_offset = reader.position();
+        }
+        return false;
+    }
 
+    // A tree of a single leaf has codes of zero bits.
+    if ((tree.root & LEAF_FLAG) != 0)
+    {
+        std::fill_n(output_array, std::max<int32_t>(output_size, 0), (char) (tree.root & 0xFFu));
+        return true;
+    }
+
+    for (int32_t o = 0; o < output_size; ++o)
+    {
+        uint16_t reference = tree.root;
+        if (reader.ensure(LOOKUP_BITS))
+        {
+            const uint16_t entry = tree.lookup[reader.peek(LOOKUP_BITS)];
+            reader.skip(entry >> LOOKUP_LENGTH_SHIFT);
+            reference = (uint16_t) (entry & ((1u << LOOKUP_LENGTH_SHIFT) - 1));
+        }
+
+        // Codes longer than LOOKUP_BITS and the last codes of the input are finished bit by bit.
+        while ((reference & LEAF_FLAG) == 0)
+        {
+            bool bit;
+            if (!reader.readBit(&bit))
+            {
+                if (error_offset != nullptr)
+                {
+                    *error_offset = reader.position();
+                }
+                return false;
+            }
+            reference = tree.branches[reference][bit ? 1 : 0];
+        }
+
+        output_array[o] = (char) (reference & 0xFFu);
+    }
+
+    return true;
+}
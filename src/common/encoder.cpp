@@ -0,0 +1,149 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <string>
+#include <queue>
+#include <vector>
+
+#include "common/common.hpp"
+
+struct EncoderNode
+{
+    uint64_t Frequency;
+    uint8_t Symbol;
+    bool IsLeaf;
+    int16_t Left;
+    int16_t Right;
+};
+
+struct EncoderCode
+{
+    uint64_t Bits;
+    uint8_t Length;
+};
+
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<uint8_t>* output) : output(output), current(0), used(0) {}
+
+    void writeBit(bool bit) {
+        current = (uint8_t) ((current << 1u) | (bit ? 1u : 0u));
+        if (++used == 8) {
+            flush();
+        }
+    }
+
+    void writeBits(uint64_t bits, uint8_t length) {
+        for (int i = length - 1; i >= 0; --i) {
+            writeBit(((bits >> (unsigned int) i) & 1u) != 0);
+        }
+    }
+
+    void finish() {
+        if (used > 0) {
+            current = (uint8_t) (current << (8u - used));
+            flush();
+        }
+    }
+
+private:
+    void flush() {
+        output->push_back(current);
+        current = 0;
+        used = 0;
+    }
+
+    std::vector<uint8_t>* output;
+    uint8_t current;
+    uint8_t used;
+};
+
+void encodeNode(const std::vector<EncoderNode>& tree, int16_t index, BitWriter* writer)
+{
+    const EncoderNode& node = tree[index];
+    writer->writeBit(node.IsLeaf);
+
+    if (node.IsLeaf)
+    {
+        writer->writeBits(node.Symbol, 8);
+    }
+    else
+    {
+        encodeNode(tree, node.Left, writer);
+        encodeNode(tree, node.Right, writer);
+    }
+}
+
+void buildCodes(const std::vector<EncoderNode>& tree, int16_t index, uint64_t bits, uint8_t length, EncoderCode* codes)
+{
+    const EncoderNode& node = tree[index];
+
+    if (node.IsLeaf)
+    {
+        codes[node.Symbol].Bits = bits;
+        codes[node.Symbol].Length = length;
+    }
+    else
+    {
+        buildCodes(tree, node.Left, bits << 1u, length + 1, codes);
+        buildCodes(tree, node.Right, (bits << 1u) | 1u, length + 1, codes);
+    }
+}
+
+bool BORDERLANDS_COMMON_API
+D4v3::Borderlands::Common::Huffman::encode(const char *input_array, uint32_t input_size,
+                                           std::vector<uint8_t> *output_array) noexcept(false) {
+    uint64_t frequencies[256] = {0};
+    for (uint32_t i = 0; i < input_size; i++) {
+        frequencies[(uint8_t) input_array[i]]++;
+    }
+
+    std::vector<EncoderNode> tree;
+    tree.reserve(511);
+
+    auto compare = [&tree](int16_t a, int16_t b) {
+        return tree[a].Frequency > tree[b].Frequency;
+    };
+    std::priority_queue<int16_t, std::vector<int16_t>, decltype(compare)> queue(compare);
+
+    for (int symbol = 0; symbol < 256; symbol++) {
+        if (frequencies[symbol] > 0) {
+            tree.push_back({frequencies[symbol], (uint8_t) symbol, true, -1, -1});
+            queue.push((int16_t) (tree.size() - 1));
+        }
+    }
+
+    // The decoder always reads at least one node, an empty input gets a single leaf.
+    if (queue.empty()) {
+        tree.push_back({0, 0, true, -1, -1});
+        queue.push(0);
+    }
+
+    while (queue.size() > 1) {
+        int16_t left = queue.top();
+        queue.pop();
+        int16_t right = queue.top();
+        queue.pop();
+
+        tree.push_back({tree[left].Frequency + tree[right].Frequency, 0, false, left, right});
+        queue.push((int16_t) (tree.size() - 1));
+    }
+
+    int16_t root = queue.top();
+
+    EncoderCode codes[256] = {};
+    buildCodes(tree, root, 0, 0, codes);
+
+    BitWriter writer(output_array);
+    encodeNode(tree, root, &writer);
+
+    for (uint32_t i = 0; i < input_size; i++) {
+        const EncoderCode& code = codes[(uint8_t) input_array[i]];
+        writer.writeBits(code.Bits, code.Length);
+    }
+
+    writer.finish();
+
+    return true;
+}
@@ -0,0 +1,80 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include <pthread.h>
+
+#include <borderlands2/daemon.hpp>
+
+/*!
+ * @brief Exit code for invalid arguments or a socket that could not be bound.
+ */
+constexpr int EXIT_ERROR = 2;
+
+/*!
+ * @brief Prints the usage of the daemon.
+ */
+static void printUsage(const char *program) {
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << "  " << program << " <socket> [<cached saves>]" << std::endl;
+}
+
+/*!
+ * @brief Parses the number of cached saves, a positive decimal number.
+ *
+ * @param[in] argument The argument to parse.
+ * @param[out] capacity The parsed number.
+ * @return True if the argument is a positive number that fits into a size_t.
+ */
+static bool parseCapacity(const char *argument, size_t &capacity) {
+    // strtoull accepts a sign and negates negative numbers instead of failing, so only digits are allowed.
+    if (argument[0] < '0' || argument[0] > '9') {
+        return false;
+    }
+    char *end = nullptr;
+    errno = 0;
+    const unsigned long long value = std::strtoull(argument, &end, 10);
+    if (errno == ERANGE || *end != '\0' || value == 0 || value > std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+    capacity = (size_t) value;
+    return true;
+}
+
+/*!
+ * @brief Serves decode requests on a Unix domain socket until SIGINT or SIGTERM is received.
+ */
+int main(int argc, char* argv[]) {
+    size_t capacity = 64;
+    if (argc < 2 || argc > 3 || (argc > 2 && !parseCapacity(argv[2], capacity))) {
+        printUsage(argv[0]);
+        return EXIT_ERROR;
+    }
+
+    // The signals are blocked before the server thread starts, so only sigwait below receives them.
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    D4v3::Borderlands::Borderlands2::Daemon::Server server(argv[1], capacity);
+    if (!server.listen()) {
+        return EXIT_ERROR;
+    }
+    std::thread serving([&server]() { server.run(); });
+
+    int signal = 0;
+    sigwait(&signals, &signal);
+    server.stop();
+    serving.join();
+    return 0;
+}
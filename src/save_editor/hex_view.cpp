@@ -0,0 +1,200 @@
+#include "save_editor/hex_view.h"
+
+#include <algorithm>
+
+#include <QFontDatabase>
+#include <QHelpEvent>
+#include <QPainter>
+#include <QScrollBar>
+#include <QStringList>
+#include <QToolTip>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+/*!
+ * @brief Number of bytes shown per line.
+ */
+constexpr int BYTES_PER_LINE = 16;
+
+/*!
+ * @brief Column of the first hex byte, the columns before hold the line offset.
+ */
+constexpr int HEX_COLUMN = 10;
+
+/*!
+ * @brief Column of the first ASCII character.
+ */
+constexpr int ASCII_COLUMN = HEX_COLUMN + BYTES_PER_LINE * 3 + 1;
+
+/*!
+ * @brief Number of columns of a line.
+ */
+constexpr int LINE_COLUMNS = ASCII_COLUMN + BYTES_PER_LINE;
+
+D4v3::Borderlands::SaveEditor::HexView::HexView(QWidget *parent) : QAbstractScrollArea(parent) {
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    line_height = fontMetrics().height();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    char_width = fontMetrics().horizontalAdvance(QLatin1Char('0'));
+#else
+    char_width = fontMetrics().width(QLatin1Char('0'));
+#endif
+    updateScrollBars();
+}
+
+void D4v3::Borderlands::SaveEditor::HexView::setData(
+        std::shared_ptr<const std::vector<uint8_t>> data,
+        std::shared_ptr<const std::vector<Borderlands2::WireFormat::FieldSpan>> fields) {
+    this->data = std::move(data);
+    this->fields = std::move(fields);
+
+    verticalScrollBar()->setValue(0);
+    updateScrollBars();
+    viewport()->update();
+}
+
+void D4v3::Borderlands::SaveEditor::HexView::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event)
+
+    QPainter painter(viewport());
+    painter.fillRect(viewport()->rect(), palette().base());
+    if (!data) {
+        return;
+    }
+
+    painter.translate(-horizontalScrollBar()->value(), 0);
+
+    const QColor header_color(255, 220, 150);
+    const QColor field_colors[] = {QColor(215, 235, 255), QColor(225, 250, 215)};
+
+    const size_t first_line = (size_t) verticalScrollBar()->value();
+    const size_t last_line = std::min(lineCount(), first_line + (size_t) (viewport()->height() / line_height) + 1);
+    const int ascent = fontMetrics().ascent();
+
+    for (size_t line = first_line; line < last_line; ++line) {
+        const int y = (int) (line - first_line) * line_height;
+        const size_t line_offset = line * BYTES_PER_LINE;
+
+        painter.setPen(palette().color(QPalette::Disabled, QPalette::Text));
+        painter.drawText(char_width, y + ascent, QString::number(line_offset, 16).rightJustified(8, '0'));
+
+        painter.setPen(palette().color(QPalette::Text));
+        for (size_t offset = line_offset; offset < std::min(line_offset + BYTES_PER_LINE, data->size()); ++offset) {
+            const int column = (int) (offset - line_offset);
+            const QRect hex_cell((HEX_COLUMN + column * 3) * char_width, y, 3 * char_width, line_height);
+            const QRect ascii_cell((ASCII_COLUMN + column) * char_width, y, char_width, line_height);
+
+            int32_t field = fieldAt(offset);
+            if (field >= 0) {
+                const Borderlands2::WireFormat::FieldSpan &span = (*fields)[field];
+                const QColor &color = offset < span.value_offset ? header_color : field_colors[field % 2];
+                painter.fillRect(hex_cell, color);
+                painter.fillRect(ascii_cell, color);
+            }
+
+            const uint8_t byte = (*data)[offset];
+            painter.drawText(hex_cell.x(), y + ascent, QString::number(byte, 16).rightJustified(2, '0'));
+            painter.drawText(ascii_cell.x(), y + ascent, byte >= 0x20 && byte < 0x7F ? QString(QChar(byte)) : QString("."));
+        }
+    }
+}
+
+void D4v3::Borderlands::SaveEditor::HexView::resizeEvent(QResizeEvent *event) {
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+}
+
+bool D4v3::Borderlands::SaveEditor::HexView::viewportEvent(QEvent *event) {
+    if (event->type() == QEvent::ToolTip) {
+        auto *help_event = static_cast<QHelpEvent *>(event);
+        int64_t offset = offsetAt(help_event->pos());
+        int32_t field = offset >= 0 ? fieldAt((size_t) offset) : -1;
+        if (field < 0) {
+            QToolTip::hideText();
+            event->ignore();
+            return true;
+        }
+
+        const Borderlands2::WireFormat::FieldSpan &span = (*fields)[field];
+        QToolTip::showText(help_event->globalPos(),
+                           tr("%1\nOffset 0x%2, %3 bytes").arg(fieldPath(field))
+                                   .arg(QString::number(span.offset, 16))
+                                   .arg(span.end - span.offset),
+                           viewport());
+        return true;
+    }
+    return QAbstractScrollArea::viewportEvent(event);
+}
+
+void D4v3::Borderlands::SaveEditor::HexView::updateScrollBars() {
+    const int visible_lines = viewport()->height() / line_height;
+    verticalScrollBar()->setRange(0, std::max(0, (int) lineCount() - visible_lines));
+    verticalScrollBar()->setPageStep(visible_lines);
+
+    const int width = (LINE_COLUMNS + 1) * char_width;
+    horizontalScrollBar()->setRange(0, std::max(0, width - viewport()->width()));
+    horizontalScrollBar()->setPageStep(viewport()->width());
+}
+
+size_t D4v3::Borderlands::SaveEditor::HexView::lineCount() const {
+    return data ? (data->size() + BYTES_PER_LINE - 1) / BYTES_PER_LINE : 0;
+}
+
+int64_t D4v3::Borderlands::SaveEditor::HexView::offsetAt(const QPoint &position) const {
+    if (!data) {
+        return -1;
+    }
+
+    const int column = (position.x() + horizontalScrollBar()->value()) / char_width;
+    int byte;
+    if (column >= HEX_COLUMN && column < HEX_COLUMN + BYTES_PER_LINE * 3) {
+        byte = (column - HEX_COLUMN) / 3;
+    } else if (column >= ASCII_COLUMN && column < LINE_COLUMNS) {
+        byte = column - ASCII_COLUMN;
+    } else {
+        return -1;
+    }
+
+    const size_t line = (size_t) verticalScrollBar()->value() + (size_t) (position.y() / line_height);
+    const size_t offset = line * BYTES_PER_LINE + (size_t) byte;
+    return offset < data->size() ? (int64_t) offset : -1;
+}
+
+int32_t D4v3::Borderlands::SaveEditor::HexView::fieldAt(size_t offset) const {
+    if (!fields || fields->empty()) {
+        return -1;
+    }
+
+    // The last field starting at or before offset either contains it or is nested in the field that does.
+    auto next = std::upper_bound(fields->begin(), fields->end(), offset,
+                                 [](size_t value, const Borderlands2::WireFormat::FieldSpan &span) {
+                                     return value < span.offset;
+                                 });
+    auto field = (int32_t) (next - fields->begin()) - 1;
+    while (field >= 0 && (*fields)[field].end <= offset) {
+        field = (*fields)[field].parent;
+    }
+    return field;
+}
+
+QString D4v3::Borderlands::SaveEditor::HexView::fieldPath(int32_t field) const {
+    std::vector<uint32_t> numbers;
+    for (int32_t current = field; current >= 0; current = (*fields)[current].parent) {
+        numbers.push_back((*fields)[current].number);
+    }
+
+    QStringList names;
+    const google::protobuf::Descriptor *descriptor = WillowTwoPlayerSaveGame::descriptor();
+    for (auto number = numbers.rbegin(); number != numbers.rend(); ++number) {
+        const google::protobuf::FieldDescriptor *descriptor_field =
+                descriptor != nullptr ? descriptor->FindFieldByNumber((int) *number) : nullptr;
+        if (descriptor_field == nullptr) {
+            names.append(QString::number(*number));
+            descriptor = nullptr;
+        } else {
+            names.append(QString::fromStdString(descriptor_field->name()));
+            descriptor = descriptor_field->message_type();
+        }
+    }
+    return names.join('.');
+}
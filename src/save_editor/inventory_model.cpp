@@ -0,0 +1,170 @@
+#include "save_editor/inventory_model.h"
+
+#include <QBrush>
+#include <QColor>
+
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+D4v3::Borderlands::SaveEditor::InventoryTableModel::InventoryTableModel(Source source, QObject *parent)
+        : QAbstractTableModel(parent), source(source) {
+}
+
+void D4v3::Borderlands::SaveEditor::InventoryTableModel::setSaveGame(
+        std::shared_ptr<const WillowTwoPlayerSaveGame> save_game) {
+    beginResetModel();
+    this->save_game = std::move(save_game);
+    decoded.clear();
+    decode_attempted.clear();
+
+    int rows = rowCount();
+    decoded.resize((size_t) rows);
+    decode_attempted.resize((size_t) rows, false);
+    endResetModel();
+}
+
+int D4v3::Borderlands::SaveEditor::InventoryTableModel::rowCount(const QModelIndex &parent) const {
+    if (parent.isValid() || !save_game) {
+        return 0;
+    }
+
+    if (source == backpack) {
+        return save_game->packedweapondata_size() + save_game->packeditemdata_size();
+    }
+    return save_game->bankslots_size();
+}
+
+int D4v3::Borderlands::SaveEditor::InventoryTableModel::columnCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : column_count;
+}
+
+QVariant D4v3::Borderlands::SaveEditor::InventoryTableModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return QVariant();
+    }
+
+    switch (role) {
+        case Qt::DisplayRole:
+            return displayData(index.row(), index.column());
+        case Qt::ForegroundRole:
+            // Only the decoded columns depend on the checksum, the remaining columns come from the save itself.
+            if (index.column() <= seed_column && decodedAt(index.row()) == nullptr) {
+                return QBrush(QColor(Qt::red));
+            }
+            return QVariant();
+        case Qt::ToolTipRole:
+            if (decodedAt(index.row()) == nullptr) {
+                return tr("The serial has an unknown version or an invalid checksum!");
+            }
+            return QVariant();
+        default:
+            return QVariant();
+    }
+}
+
+QVariant D4v3::Borderlands::SaveEditor::InventoryTableModel::headerData(int section, Qt::Orientation orientation,
+                                                                       int role) const {
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    if (orientation == Qt::Vertical) {
+        return section + 1;
+    }
+
+    switch (section) {
+        case type_column:
+            return tr("Type");
+        case set_column:
+            return tr("Asset Set");
+        case seed_column:
+            return tr("Seed");
+        case quantity_column:
+            return tr("Quantity");
+        case slot_column:
+            return tr("Slot");
+        case mark_column:
+            return tr("Mark");
+        case serial_column:
+            return tr("Serial");
+        default:
+            return QVariant();
+    }
+}
+
+const std::string &D4v3::Borderlands::SaveEditor::InventoryTableModel::serialAt(int row) const {
+    if (source == bank) {
+        return save_game->bankslots(row).inventoryserialnumber();
+    }
+
+    if (row < save_game->packedweapondata_size()) {
+        return save_game->packedweapondata(row).inventoryserialnumber();
+    }
+    return save_game->packeditemdata(row - save_game->packedweapondata_size()).inventoryserialnumber();
+}
+
+const D4v3::Borderlands::Borderlands2::Serial::DecodedSerial *
+D4v3::Borderlands::SaveEditor::InventoryTableModel::decodedAt(int row) const {
+    if (!decode_attempted[row]) {
+        decode_attempted[row] = true;
+
+        std::unique_ptr<Borderlands2::Serial::DecodedSerial> serial(new Borderlands2::Serial::DecodedSerial());
+        if (Borderlands2::Serial::decodeSerial(serialAt(row), serial.get())) {
+            decoded[row] = std::move(serial);
+        }
+    }
+    return decoded[row].get();
+}
+
+QVariant D4v3::Borderlands::SaveEditor::InventoryTableModel::displayData(int row, int column) const {
+    const PackedWeaponData *weapon = nullptr;
+    const PackedItemData *item = nullptr;
+    if (source == backpack) {
+        if (row < save_game->packedweapondata_size()) {
+            weapon = &save_game->packedweapondata(row);
+        } else {
+            item = &save_game->packeditemdata(row - save_game->packedweapondata_size());
+        }
+    }
+
+    switch (column) {
+        case type_column: {
+            const Borderlands2::Serial::DecodedSerial *serial = decodedAt(row);
+            if (serial == nullptr) {
+                return tr("Invalid");
+            }
+            return serial->is_weapon ? tr("Weapon") : tr("Item");
+        }
+        case set_column: {
+            const Borderlands2::Serial::DecodedSerial *serial = decodedAt(row);
+            return serial == nullptr ? QVariant() : QVariant((int) serial->asset_library_set_id);
+        }
+        case seed_column: {
+            const Borderlands2::Serial::DecodedSerial *serial = decodedAt(row);
+            return serial == nullptr ? QVariant() : QVariant(QString::number(serial->seed, 16).rightJustified(8, '0'));
+        }
+        case quantity_column:
+            return item == nullptr ? QVariant() : QVariant(item->quantity());
+        case slot_column:
+            if (weapon != nullptr) {
+                return QString::fromStdString(QuickWeaponSlot_Name(weapon->quickslot()));
+            }
+            if (item != nullptr) {
+                return item->equipped() ? tr("Equipped") : QVariant();
+            }
+            return QVariant();
+        case mark_column:
+            if (weapon != nullptr) {
+                return QString::fromStdString(PlayerMark_Name(weapon->mark()));
+            }
+            if (item != nullptr && PlayerMark_IsValid(item->mark())) {
+                return QString::fromStdString(PlayerMark_Name((PlayerMark) item->mark()));
+            }
+            return QVariant();
+        case serial_column: {
+            const std::string &serial = serialAt(row);
+            return QString(QByteArray(serial.data(), (int) serial.size()).toHex());
+        }
+        default:
+            return QVariant();
+    }
+}
@@ -1,41 +1,126 @@
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <string>
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTimer>
 #include <QWidget>
 #include <QMainWindow>
 #include <QTranslator>
 
 #include "save_editor/main.h"
+#include "save_editor/main_window.h"
 
 #include "common/common.hpp"
 
+#if defined(__linux__)
+#include <time.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
 
-#include "ui_SaveEditor_MainWindow.h"
-
-//static Borderlands::SaveEditor::SaveFile* save;
-
-static void saveFunc() {
-    //save->save();
+/*!
+ * @brief Returns the time in ms since the process was started.
+ *
+ * @details The startup benchmark has to include loading the shared libraries and the static initializers, as
+ *  the descriptors of the protobuf messages, which all run before main. The start time of the process is read
+ *  from the system, on Linux from /proc/self/stat with a resolution of one clock tick.
+ *
+ * @param[in] main_timer Started first thing in main, used if the start time of the process is not available.
+ */
+static qint64 processUptime(const QElapsedTimer &main_timer) {
+#if defined(__linux__)
+    std::ifstream stat_file("/proc/self/stat");
+    std::string stat((std::istreambuf_iterator<char>(stat_file)), std::istreambuf_iterator<char>());
+    // The name of the executable in the second field may hold spaces, the fields after it are counted from its ')'.
+    const size_t name_end = stat.rfind(')');
+    if (name_end != std::string::npos) {
+        std::istringstream fields(stat.substr(name_end + 1));
+        std::string field;
+        // The start time in clock ticks since boot is field 22, the first after the name is field 3.
+        int field_number = 3;
+        while (field_number < 22 && (fields >> field)) {
+            ++field_number;
+        }
+        unsigned long long start_ticks = 0;
+        struct timespec now{};
+        const long ticks_per_second = sysconf(_SC_CLK_TCK);
+        if ((fields >> start_ticks) && ticks_per_second > 0 && clock_gettime(CLOCK_BOOTTIME, &now) == 0) {
+            const qint64 now_ms = (qint64) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+            return now_ms - (qint64) (start_ticks * 1000 / ticks_per_second);
+        }
+    }
+#elif defined(_WIN32)
+    FILETIME creation, exit_time, kernel_time, user_time, now;
+    if (GetProcessTimes(GetCurrentProcess(), &creation, &exit_time, &kernel_time, &user_time)) {
+        GetSystemTimeAsFileTime(&now);
+        ULARGE_INTEGER start_time, now_time;
+        start_time.LowPart = creation.dwLowDateTime;
+        start_time.HighPart = creation.dwHighDateTime;
+        now_time.LowPart = now.dwLowDateTime;
+        now_time.HighPart = now.dwHighDateTime;
+        // File times count 100 ns intervals.
+        return (qint64) ((now_time.QuadPart - start_time.QuadPart) / 10000);
+    }
+#endif
+    return main_timer.elapsed();
 }
 
-
 int main(int argc, char* argv[]) {
+    QElapsedTimer startup_timer;
+    startup_timer.start();
 
     auto* app = new QApplication(argc, argv);
 
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addPositionalArgument("save", QCoreApplication::translate("main", "The save file to open."));
+    QCommandLineOption benchmark_option("startup-benchmark",
+            QCoreApplication::translate("main", "Print the time from the process start until the window is painted and exit."));
+    QCommandLineOption budget_option("startup-budget",
+            QCoreApplication::translate("main", "Exit with an error if the startup benchmark takes longer than <ms>."),
+            "ms");
+    parser.addOption(benchmark_option);
+    parser.addOption(budget_option);
+    parser.process(*app);
+
     QTranslator translator;
     translator.load(":/translations/save_editor_en");
     app->installTranslator(&translator);
 
-    QMainWindow* mainWindow = new QMainWindow;
+    auto* mainWindow = new D4v3::Borderlands::SaveEditor::MainWindow;
+    mainWindow->show();
 
-    Ui::MainWindow ui;
-    ui.setupUi(mainWindow);
+    if (parser.isSet(benchmark_option)) {
+        QTimer::singleShot(0, mainWindow, [&]() {
+            mainWindow->repaint();
+            qint64 elapsed = processUptime(startup_timer);
+            std::cout << "Startup time (ms): " << elapsed << std::endl;
 
-    //save = new Borderlands::SaveEditor::SaveFile();
+            bool valid = true;
+            qint64 budget = parser.isSet(budget_option) ? parser.value(budget_option).toLongLong(&valid) : elapsed;
+            if (!valid || elapsed > budget) {
+                std::cerr << "Startup exceeded the budget of " << budget << " ms!" << std::endl;
+                app->exit(1);
+            } else {
+                app->exit(0);
+            }
+        });
+        return app->exec();
+    }
 
-    QObject::connect(ui.actionExit, &QAction::triggered, mainWindow, &QMainWindow::close);
-    QObject::connect(ui.actionSave, &QAction::triggered, mainWindow, &saveFunc);
+    // The save is opened from the event loop, so the empty window is painted before the loader starts and
+    // the protobuf descriptors and the library logger are first set up on the worker thread.
+    const QStringList arguments = parser.positionalArguments();
+    if (!arguments.isEmpty()) {
+        const QString path = arguments.first();
+        QTimer::singleShot(0, mainWindow, [mainWindow, path]() {
+            mainWindow->openSave(path);
+        });
+    }
 
-    mainWindow->show();
 	return app->exec();
 }
@@ -0,0 +1,379 @@
+#include "save_editor/main_window.h"
+
+#include <exception>
+#include <limits>
+
+#include <QDir>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QFormLayout>
+#include <QHeaderView>
+#include <QListWidget>
+#include <QMessageBox>
+#include <QSpinBox>
+#include <QStatusBar>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/edit.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+#include "ui_SaveEditor_MainWindow.h"
+
+D4v3::Borderlands::SaveEditor::MainWindow::MainWindow(QWidget *parent)
+        : QMainWindow(parent), ui(new Ui::MainWindow),
+          backpack_model(InventoryTableModel::backpack), bank_model(InventoryTableModel::bank),
+          backpack_view(nullptr), bank_view(nullptr), raw_view(nullptr) {
+    ui->setupUi(this);
+
+    load_stage_label = new QLabel(this);
+    load_progress = new QProgressBar(this);
+    load_progress->setRange(0, D4v3::Borderlands::Borderlands2::LoadStage::finished);
+    load_progress->setMaximumWidth(200);
+    load_stage_label->hide();
+    load_progress->hide();
+    statusBar()->addPermanentWidget(load_stage_label);
+    statusBar()->addPermanentWidget(load_progress);
+
+    ui->actionSave->setEnabled(false);
+    ui->actionSave_As->setEnabled(false);
+
+    QObject::connect(ui->actionExit, &QAction::triggered, this, &QMainWindow::close);
+    QObject::connect(ui->actionOpen, &QAction::triggered, this, &MainWindow::onOpenTriggered);
+    QObject::connect(ui->actionSave, &QAction::triggered, this, &MainWindow::onSaveTriggered);
+    QObject::connect(ui->actionSave_As, &QAction::triggered, this, &MainWindow::onSaveAsTriggered);
+    QObject::connect(ui->actionUndo, &QAction::triggered, this, &MainWindow::onUndoTriggered);
+    QObject::connect(ui->actionRedo, &QAction::triggered, this, &MainWindow::onRedoTriggered);
+    QObject::connect(ui->tabWidget, &QTabWidget::currentChanged, this, &MainWindow::onCurrentTabChanged);
+
+    QObject::connect(&loader, &SaveLoader::stageChanged, this, &MainWindow::onLoadStageChanged);
+    QObject::connect(&loader, &SaveLoader::loaded, this, &MainWindow::onSaveLoaded);
+    QObject::connect(&loader, &SaveLoader::failed, this, &MainWindow::onLoadFailed);
+}
+
+D4v3::Borderlands::SaveEditor::MainWindow::~MainWindow() {
+    delete ui;
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onCurrentTabChanged(int index) {
+    populateTab(index);
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::populateTab(int index) {
+    QWidget *tab = ui->tabWidget->widget(index);
+    if (!save_game || tab == nullptr || populated_tabs.contains(tab)) {
+        return;
+    }
+    populated_tabs.insert(tab);
+
+    if (tab == ui->general_tab) {
+        setTabContent(tab, createGeneralContent());
+    } else if (tab == ui->backpack_tab) {
+        if (backpack_view == nullptr) {
+            backpack_view = createInventoryView(tab, &backpack_model);
+        }
+        backpack_model.setSaveGame(save_game);
+    } else if (tab == ui->bank_tab) {
+        if (bank_view == nullptr) {
+            bank_view = createInventoryView(tab, &bank_model);
+        }
+        bank_model.setSaveGame(save_game);
+    } else if (tab == ui->raw_tab) {
+        if (raw_view == nullptr) {
+            raw_view = new HexView(tab);
+            new QVBoxLayout(tab);
+            tab->layout()->addWidget(raw_view);
+        }
+        raw_view->setData(save_payload, save_fields);
+    } else if (tab == ui->character_tab) {
+        setTabContent(tab, createCharacterContent());
+    } else if (tab == ui->currency_tab) {
+        setTabContent(tab, createCurrencyContent());
+    } else if (tab == ui->fast_travel_tab) {
+        setTabContent(tab, createFastTravelContent());
+    }
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::setTabContent(QWidget *tab, QWidget *content) {
+    if (tab->layout() == nullptr) {
+        new QVBoxLayout(tab);
+    }
+
+    QWidget *previous = tab_contents.value(tab, nullptr);
+    if (previous != nullptr) {
+        tab->layout()->removeWidget(previous);
+        previous->deleteLater();
+    }
+
+    tab->layout()->addWidget(content);
+    tab_contents.insert(tab, content);
+}
+
+/*!
+ * @brief Creates a selectable label for a read only value.
+ */
+QLabel *createValueLabel(const QString &text) {
+    auto *label = new QLabel(text);
+    label->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    return label;
+}
+
+QWidget *D4v3::Borderlands::SaveEditor::MainWindow::createGeneralContent() const {
+    auto *content = new QWidget();
+    auto *layout = new QFormLayout(content);
+
+    int32_t play_time = save_game->totalplaytime();
+    layout->addRow(tr("Name"), createValueLabel(QString::fromStdString(save_game->uipreferences().charactername())));
+    layout->addRow(tr("Class"), createValueLabel(QString::fromStdString(save_game->playerclass())));
+    layout->addRow(tr("Level"), createValueLabel(QString::number(save_game->explevel())));
+    layout->addRow(tr("Playthroughs Completed"), createValueLabel(QString::number(save_game->playthroughscompleted())));
+    layout->addRow(tr("Save Game Id"), createValueLabel(QString::number(save_game->savegameid())));
+    layout->addRow(tr("Last Saved"), createValueLabel(QString::fromStdString(save_game->lastsaveddate())));
+    layout->addRow(tr("Total Play Time"), createValueLabel(
+            tr("%1 h %2 min").arg(play_time / 3600).arg((play_time / 60) % 60, 2, 10, QChar('0'))));
+    layout->addRow(tr("Badass Mode"), createValueLabel(save_game->isbadassmodesavegame() ? tr("Yes") : tr("No")));
+
+    return content;
+}
+
+QWidget *D4v3::Borderlands::SaveEditor::MainWindow::createCharacterContent() const {
+    auto *content = new QWidget();
+    auto *layout = new QVBoxLayout(content);
+
+    auto *form = new QFormLayout();
+    form->addRow(tr("Level"), createValueLabel(QString::number(save_game->explevel())));
+    form->addRow(tr("Experience"), createValueLabel(QString::number(save_game->exppoints())));
+    form->addRow(tr("General Skill Points"), createValueLabel(QString::number(save_game->generalskillpoints())));
+    form->addRow(tr("Specialist Skill Points"), createValueLabel(QString::number(save_game->specialistskillpoints())));
+    layout->addLayout(form);
+
+    auto *skills = new QTableWidget(save_game->skilldata_size(), 4);
+    skills->setHorizontalHeaderLabels({tr("Skill"), tr("Grade"), tr("Grade Points"), tr("Equipped Slot")});
+    skills->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    skills->horizontalHeader()->setStretchLastSection(true);
+    for (int i = 0; i < save_game->skilldata_size(); ++i) {
+        const SkillData &skill = save_game->skilldata(i);
+        skills->setItem(i, 0, new QTableWidgetItem(QString::fromStdString(skill.skill())));
+        skills->setItem(i, 1, new QTableWidgetItem(QString::number(skill.grade())));
+        skills->setItem(i, 2, new QTableWidgetItem(QString::number(skill.gradepoints())));
+        skills->setItem(i, 3, new QTableWidgetItem(QString::number(skill.equippedslotindex())));
+    }
+    layout->addWidget(skills);
+
+    return content;
+}
+
+QWidget *D4v3::Borderlands::SaveEditor::MainWindow::createCurrencyContent() {
+    auto *content = new QWidget();
+    auto *layout = new QFormLayout(content);
+
+    // The order of CurrencyOnHand is fixed by the game, unknown entries are listed by index.
+    const QStringList names = {tr("Money"), tr("Eridium"), tr("Seraph Crystals"), tr("Unknown"), tr("Torgue Tokens")};
+    for (int i = 0; i < save_game->currencyonhand_size(); ++i) {
+        QString name = i < names.size() ? names[i] : tr("Currency %1").arg(i);
+
+        auto *amount = new QSpinBox();
+        amount->setRange(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+        amount->setValue(save_game->currencyonhand(i));
+        QObject::connect(amount, &QSpinBox::editingFinished, this, [this, content, amount, i]() {
+            // A content replaced after an undo can still lose focus, its values are outdated.
+            if (tab_contents.value(ui->currency_tab, nullptr) == content) {
+                setCurrency(i, amount->value());
+            }
+        });
+        layout->addRow(name, amount);
+    }
+
+    return content;
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::setCurrency(int index, int32_t amount) {
+    if (!history || index >= save_game->currencyonhand_size() || save_game->currencyonhand(index) == amount) {
+        return;
+    }
+
+    Borderlands2::Edit::FieldValue value;
+    value.integer = amount;
+    if (!history->set({{WillowTwoPlayerSaveGame::kCurrencyOnHandFieldNumber, index}}, value)) {
+        statusBar()->showMessage(tr("The currency could not be changed!"), 5000);
+    }
+    updateEditActions();
+}
+
+QWidget *D4v3::Borderlands::SaveEditor::MainWindow::createFastTravelContent() const {
+    auto *content = new QWidget();
+    auto *layout = new QVBoxLayout(content);
+
+    auto *form = new QFormLayout();
+    form->addRow(tr("Last Visited"), createValueLabel(QString::fromStdString(save_game->lastvisitedteleporter())));
+    layout->addLayout(form);
+
+    auto *teleporters = new QListWidget();
+    for (const std::string &teleporter : save_game->visitedteleporters()) {
+        teleporters->addItem(QString::fromStdString(teleporter));
+    }
+    layout->addWidget(teleporters);
+
+    return content;
+}
+
+QTableView *D4v3::Borderlands::SaveEditor::MainWindow::createInventoryView(QWidget *tab, InventoryTableModel *model) {
+    auto *layout = new QVBoxLayout(tab);
+    auto *view = new QTableView(tab);
+    view->setModel(model);
+    view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    view->setAlternatingRowColors(true);
+    view->setWordWrap(false);
+
+    // Fixed row heights let the view place rows without asking the model for size hints, so only the visible rows
+    // are ever requested and decoded. Resizing to contents would touch every row of the model.
+    view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    view->verticalHeader()->setDefaultSectionSize(view->fontMetrics().height() + 6);
+    view->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+    view->horizontalHeader()->setStretchLastSection(true);
+
+    layout->addWidget(view);
+    return view;
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::openSave(const QString &path) {
+    if (!loader.load(path)) {
+        statusBar()->showMessage(tr("Another save is still loading!"), 5000);
+        return;
+    }
+
+    ui->actionOpen->setEnabled(false);
+    load_progress->setValue(0);
+    load_stage_label->show();
+    load_progress->show();
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onOpenTriggered() {
+    QString path = QFileDialog::getOpenFileName(this, tr("Open Save"), QFileInfo(save_path).absolutePath(),
+                                                tr("Borderlands 2 Saves (*.sav)"));
+    if (!path.isEmpty()) {
+        openSave(path);
+    }
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onLoadStageChanged(int stage) {
+    switch (stage) {
+        case D4v3::Borderlands::Borderlands2::LoadStage::reading_file:
+            load_stage_label->setText(tr("Reading file ..."));
+            break;
+        case D4v3::Borderlands::Borderlands2::LoadStage::decompressing:
+            load_stage_label->setText(tr("Decompressing ..."));
+            break;
+        case D4v3::Borderlands::Borderlands2::LoadStage::huffman_decoding:
+            load_stage_label->setText(tr("Decoding ..."));
+            break;
+        case D4v3::Borderlands::Borderlands2::LoadStage::parsing:
+            load_stage_label->setText(tr("Parsing ..."));
+            break;
+        default:
+            load_stage_label->setText(tr("Done"));
+            break;
+    }
+    load_progress->setValue(stage);
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onSaveLoaded(const LoadedSave &save, const QString &path) {
+    // The worker never touches the shown save, replacing the pointers here swaps the whole model at once.
+    save_game = save.save_game;
+    save_payload = save.payload;
+    save_fields = save.fields;
+    save_path = path;
+    history.reset(new Borderlands2::Edit::EditHistory(save_game.get()));
+
+    refreshTabs();
+    updateEditActions();
+
+    ui->actionOpen->setEnabled(true);
+    ui->actionSave->setEnabled(true);
+    ui->actionSave_As->setEnabled(true);
+    load_stage_label->hide();
+    load_progress->hide();
+
+    setWindowTitle(tr("Borderlands Save Editor") + " - " + QFileInfo(save_path).fileName());
+    statusBar()->showMessage(tr("Loaded %1").arg(QString::fromStdString(this->save_game->playerclass())), 5000);
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::refreshTabs() {
+    // Tabs are rebuilt for the changed save when they are shown next, the models drop the save right away.
+    populated_tabs.clear();
+    backpack_model.setSaveGame(nullptr);
+    bank_model.setSaveGame(nullptr);
+    if (raw_view != nullptr) {
+        raw_view->setData(nullptr, nullptr);
+    }
+    populateTab(ui->tabWidget->currentIndex());
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::updateEditActions() {
+    ui->actionUndo->setEnabled(history && history->canUndo());
+    ui->actionRedo->setEnabled(history && history->canRedo());
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onUndoTriggered() {
+    if (history && history->undo()) {
+        refreshTabs();
+    }
+    updateEditActions();
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onRedoTriggered() {
+    if (history && history->redo()) {
+        refreshTabs();
+    }
+    updateEditActions();
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onSaveTriggered() {
+    saveTo(save_path);
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onSaveAsTriggered() {
+    QString path = QFileDialog::getSaveFileName(this, tr("Save As"), save_path, tr("Borderlands 2 Saves (*.sav)"));
+    if (!path.isEmpty()) {
+        saveTo(path);
+    }
+}
+
+bool D4v3::Borderlands::SaveEditor::MainWindow::saveTo(const QString &path) {
+    if (!history || loader.isLoading()) {
+        return false;
+    }
+
+    // The edits are replayed onto the file they were made on, so the save is written as loaded plus the edits.
+    const std::string original_path = QDir::toNativeSeparators(save_path).toLocal8Bit().toStdString();
+    const std::string target_path = QDir::toNativeSeparators(path).toLocal8Bit().toStdString();
+    bool success = false;
+    try {
+        success = Borderlands2::Edit::replaySave(original_path, history->edits(), target_path);
+    } catch (std::exception &) {
+        success = false;
+    }
+
+    if (!success) {
+        QMessageBox::warning(this, tr("Save"), tr("The save file %1 could not be written!").arg(path));
+        return false;
+    }
+
+    // The written file contains all edits, later edits are replayed onto it.
+    save_path = path;
+    history->clear();
+    updateEditActions();
+
+    setWindowTitle(tr("Borderlands Save Editor") + " - " + QFileInfo(save_path).fileName());
+    statusBar()->showMessage(tr("Saved %1").arg(save_path), 5000);
+    return true;
+}
+
+void D4v3::Borderlands::SaveEditor::MainWindow::onLoadFailed(const QString &path) {
+    ui->actionOpen->setEnabled(true);
+    load_stage_label->hide();
+    load_progress->hide();
+
+    QMessageBox::warning(this, tr("Open Save"), tr("The save file %1 could not be loaded!").arg(path));
+}
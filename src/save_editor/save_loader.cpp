@@ -0,0 +1,69 @@
+#include "save_editor/save_loader.h"
+
+#include <exception>
+
+#include <QDir>
+#include <QtConcurrent/QtConcurrent>
+
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+D4v3::Borderlands::SaveEditor::SaveLoader::SaveLoader(QObject *parent) : QObject(parent) {
+    QObject::connect(&watcher, &QFutureWatcher<LoadedSave>::finished,
+                     this, &SaveLoader::onFinished);
+}
+
+D4v3::Borderlands::SaveEditor::SaveLoader::~SaveLoader() {
+    watcher.waitForFinished();
+}
+
+bool D4v3::Borderlands::SaveEditor::SaveLoader::load(const QString &path) {
+    if (isLoading()) {
+        return false;
+    }
+
+    this->path = path;
+    const std::string file_path = QDir::toNativeSeparators(path).toLocal8Bit().toStdString();
+
+    watcher.setFuture(QtConcurrent::run([this, file_path]() -> LoadedSave {
+        auto save_game = std::make_shared<WillowTwoPlayerSaveGame>();
+        auto payload = std::make_shared<std::vector<uint8_t>>();
+        try {
+            bool success = D4v3::Borderlands::Borderlands2::readSave(file_path, save_game.get(), payload.get(),
+                    [this](D4v3::Borderlands::Borderlands2::LoadStage stage) {
+                        emit stageChanged((int) stage);
+                    });
+            if (!success) {
+                return LoadedSave();
+            }
+        } catch (std::exception &) {
+            return LoadedSave();
+        }
+
+        LoadedSave save;
+        save.save_game = save_game;
+        save.payload = payload;
+
+        auto fields = std::make_shared<std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan>>();
+        if (D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(payload->data(), payload->size(),
+                                                                          fields.get())) {
+            save.fields = fields;
+        }
+        return save;
+    }));
+
+    return true;
+}
+
+bool D4v3::Borderlands::SaveEditor::SaveLoader::isLoading() const {
+    return watcher.isRunning();
+}
+
+void D4v3::Borderlands::SaveEditor::SaveLoader::onFinished() {
+    LoadedSave save = watcher.result();
+    if (save.save_game) {
+        emit loaded(save, path);
+    } else {
+        emit failed(path);
+    }
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <google/protobuf/arena.h>
+
+#include <borderlands2/backup.hpp>
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/diff.hpp>
+#include <borderlands2/json.hpp>
+#include <borderlands2/query.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+/*!
+ * @brief Exit code if a command found differences, as used by diff.
+ */
+constexpr int EXIT_DIFFERENT = 1;
+
+/*!
+ * @brief Exit code for invalid arguments or saves that could not be read.
+ */
+constexpr int EXIT_ERROR = 2;
+
+/*!
+ * @brief A command of the tool.
+ */
+struct Command {
+    size_t min_arguments;
+    size_t max_arguments;
+    std::string usage;
+    std::function<int(const std::vector<std::string> &)> run;
+};
+
+/*!
+ * @brief Prints the differences between two saves.
+ *
+ * @return 0 if the saves are equal, EXIT_DIFFERENT if they differ, EXIT_ERROR if a save could not be read.
+ */
+int diffCommand(const std::vector<std::string> &arguments) {
+    WillowTwoPlayerSaveGame old_save;
+    WillowTwoPlayerSaveGame new_save;
+    for (size_t i = 0; i < 2; ++i) {
+        if (!D4v3::Borderlands::Borderlands2::readSave(arguments[i], i == 0 ? &old_save : &new_save)) {
+            std::cerr << "Failed to read save " << arguments[i] << "!" << std::endl;
+            return EXIT_ERROR;
+        }
+    }
+
+    std::vector<D4v3::Borderlands::Borderlands2::Diff::Change> changes;
+    D4v3::Borderlands::Borderlands2::Diff::diffSaves(old_save, new_save, &changes);
+    std::cout << D4v3::Borderlands::Borderlands2::Diff::formatChanges(changes);
+    return changes.empty() ? 0 : EXIT_DIFFERENT;
+}
+
+/*!
+ * @brief Packs a save directory into a zip archive.
+ */
+int backupCommand(const std::vector<std::string> &arguments) {
+    if (!D4v3::Borderlands::Borderlands2::Backup::backupSaves(arguments[0], arguments[1])) {
+        std::cerr << "Failed to back up " << arguments[0] << "!" << std::endl;
+        return EXIT_ERROR;
+    }
+    return 0;
+}
+
+/*!
+ * @brief Writes a save as JSON to a file, or to the standard output if the file is "-".
+ */
+int exportCommand(const std::vector<std::string> &arguments) {
+    WillowTwoPlayerSaveGame save_game;
+    if (!D4v3::Borderlands::Borderlands2::readSave(arguments[0], &save_game)) {
+        std::cerr << "Failed to read save " << arguments[0] << "!" << std::endl;
+        return EXIT_ERROR;
+    }
+
+    const bool success = arguments[1] == "-"
+                         ? D4v3::Borderlands::Borderlands2::Json::exportJson(save_game, stdout)
+                         : D4v3::Borderlands::Borderlands2::Json::exportJson(save_game, arguments[1]);
+    if (!success) {
+        std::cerr << "Failed to write " << arguments[1] << "!" << std::endl;
+        return EXIT_ERROR;
+    }
+    return 0;
+}
+
+/*!
+ * @brief Reads a save from a JSON file and writes it as a save file.
+ */
+int importCommand(const std::vector<std::string> &arguments) {
+    google::protobuf::Arena arena;
+    auto *save_game = google::protobuf::Arena::CreateMessage<WillowTwoPlayerSaveGame>(&arena);
+    if (!D4v3::Borderlands::Borderlands2::Json::importJson(arguments[0], save_game)) {
+        std::cerr << "Failed to import " << arguments[0] << "!" << std::endl;
+        return EXIT_ERROR;
+    }
+    if (!D4v3::Borderlands::Borderlands2::writeSave(*save_game, arguments[1])) {
+        std::cerr << "Failed to write save " << arguments[1] << "!" << std::endl;
+        return EXIT_ERROR;
+    }
+    return 0;
+}
+
+/*!
+ * @brief Runs a query over a save or all saves below a directory.
+ *
+ * @details Prints the matching saves, or the counts if the query counts by a field.
+ */
+int queryCommand(const std::vector<std::string> &arguments) {
+    D4v3::Borderlands::Borderlands2::Query::SaveQuery query;
+    if (!D4v3::Borderlands::Borderlands2::Query::parseQuery(
+            std::vector<std::string>(arguments.begin() + 1, arguments.end()), &query)) {
+        std::cerr << "Invalid query!" << std::endl;
+        return EXIT_ERROR;
+    }
+
+    std::vector<std::string> paths;
+    if (boost::filesystem::is_directory(arguments[0])) {
+        for (const auto &entry : boost::filesystem::recursive_directory_iterator(arguments[0])) {
+            if (boost::filesystem::is_regular_file(entry.status()) && entry.path().extension() == ".sav") {
+                paths.push_back(entry.path().string());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+    } else {
+        paths.push_back(arguments[0]);
+    }
+
+    D4v3::Borderlands::Borderlands2::Query::QueryResult result;
+    if (!D4v3::Borderlands::Borderlands2::Query::runQuery(paths, query, &result)) {
+        return EXIT_ERROR;
+    }
+    if (query.count_by.empty()) {
+        for (const std::string &match : result.matches) {
+            std::cout << match << std::endl;
+        }
+    } else {
+        for (const auto &count : result.counts) {
+            std::cout << count.first << ": " << count.second << std::endl;
+        }
+    }
+    if (result.failed > 0) {
+        std::cerr << result.failed << " saves could not be read!" << std::endl;
+    }
+    return 0;
+}
+
+/*!
+ * @brief Restores the given saves, or all saves if none are given, from a zip archive.
+ */
+int restoreCommand(const std::vector<std::string> &arguments) {
+    const std::vector<std::string> names(arguments.begin() + 2, arguments.end());
+    if (!D4v3::Borderlands::Borderlands2::Backup::restoreSaves(arguments[0], arguments[1], names)) {
+        std::cerr << "Failed to restore from " << arguments[0] << "!" << std::endl;
+        return EXIT_ERROR;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    const std::map<std::string, Command> commands = {
+            {"backup",  {2, 2,        "backup <save directory> <archive>", backupCommand}},
+            {"diff",    {2, 2,        "diff <old save> <new save>", diffCommand}},
+            {"export",  {2, 2,        "export <save> <json file | ->", exportCommand}},
+            {"import",  {2, 2,        "import <json file> <save>", importCommand}},
+            {"query",   {1, SIZE_MAX, "query <save directory | save> [<field><op><value> | !<field><op><value> | count:<field>...]", queryCommand}},
+            {"restore", {2, SIZE_MAX, "restore <archive> <save directory> [<save>...]", restoreCommand}},
+    };
+
+    auto command = argc > 1 ? commands.find(argv[1]) : commands.end();
+    const std::vector<std::string> arguments(argc > 2 ? argv + 2 : argv + argc, argv + argc);
+    if (command == commands.end() || arguments.size() < command->second.min_arguments ||
+        arguments.size() > command->second.max_arguments) {
+        std::cerr << "Usage:" << std::endl;
+        for (const auto &entry : commands) {
+            std::cerr << "  " << argv[0] << " " << entry.second.usage << std::endl;
+        }
+        return EXIT_ERROR;
+    }
+
+    return command->second.run(arguments);
+}
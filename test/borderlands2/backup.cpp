@@ -0,0 +1,79 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <borderlands2/backup.hpp>
+#include <borderlands2/generator.hpp>
+
+#include "save_directory.hpp"
+
+class BackupTest : public SaveDirectoryTest {
+protected:
+    void SetUp() override {
+        SaveDirectoryTest::SetUp();
+        save_directory = root / "76561198034853688";
+        restore_directory = root / "restore";
+        archive = root / "backup.zip";
+        boost::filesystem::create_directories(save_directory);
+
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.packed_weapons = 20;
+        options.missions_per_playthrough = 10;
+        ASSERT_FALSE(generateSaves(6, options, save_directory).empty());
+    }
+
+    static std::string readFile(const boost::filesystem::path &path) {
+        boost::filesystem::ifstream stream(path, std::ios::in | std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    boost::filesystem::path save_directory;
+    boost::filesystem::path restore_directory;
+    boost::filesystem::path archive;
+};
+
+TEST_F(BackupTest, BackupAndRestoreAll) {
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Backup::backupSaves(save_directory.string(), archive.string(), 3));
+
+    std::vector<std::string> names;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Backup::listBackup(archive.string(), &names));
+    ASSERT_EQ(6u, names.size());
+    EXPECT_EQ("Save0001.sav", names.front());
+
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Backup::restoreSaves(archive.string(), restore_directory.string()));
+    for (uint32_t i = 1; i <= 6; ++i) {
+        EXPECT_EQ(readFile(savePath(i, save_directory)), readFile(savePath(i, restore_directory)));
+    }
+}
+
+TEST_F(BackupTest, RestoreSelectedSaves) {
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Backup::backupSaves(save_directory.string(), archive.string()));
+
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Backup::restoreSaves(archive.string(), restore_directory.string(),
+                                                                      {"Save0002", "Save0005.sav"}));
+    EXPECT_EQ(readFile(savePath(2, save_directory)), readFile(restore_directory / "Save0002.sav"));
+    EXPECT_EQ(readFile(savePath(5, save_directory)), readFile(restore_directory / "Save0005.sav"));
+    EXPECT_FALSE(boost::filesystem::exists(restore_directory / "Save0001.sav"));
+
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Backup::restoreSaves(archive.string(), restore_directory.string(),
+                                                                       {"Save0009"}));
+}
+
+TEST_F(BackupTest, MissingDirectoryOrArchive) {
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Backup::backupSaves((root / "missing").string(), archive.string()));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Backup::restoreSaves(archive.string(), restore_directory.string()));
+}
+
+TEST_F(BackupTest, FailedRestoreRemovesTemporaryFile) {
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Backup::backupSaves(save_directory.string(), archive.string()));
+
+    // A save can not replace a directory that is not empty, so the rename of the restored save fails.
+    boost::filesystem::create_directories(restore_directory / "Save0003.sav" / "blocked");
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Backup::restoreSaves(archive.string(), restore_directory.string(),
+                                                                       {"Save0003.sav"}));
+    EXPECT_TRUE(boost::filesystem::is_directory(restore_directory / "Save0003.sav"));
+    EXPECT_FALSE(boost::filesystem::exists(restore_directory / "Save0003.sav.restore"));
+}
@@ -2,9 +2,29 @@
 // Created by David Oberacker on 2019-08-02.
 //
 
+#include <atomic>
+#include <thread>
+
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <openssl/sha.h>
+#include <minilzo-2.10/minilzo.h>
 #include <borderlands2/borderlands2.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+#include "save_directory.hpp"
+
+/*!
+ * @brief The number of threads of the concurrency tests.
+ */
+constexpr size_t STRESS_THREADS = 32;
+
+/*!
+ * @brief The number of saves every thread of the concurrency tests reads or writes.
+ */
+constexpr size_t STRESS_ITERATIONS = 8;
 
 class Borderlands2Test : public ::testing::Test {
 protected:
@@ -28,13 +48,204 @@ protected:
         // Code here will be called immediately after each test (right
         // before the destructor).
     }
+
+    static std::string resourcePath(const std::string &path) {
+        return (boost::filesystem::path(BORDERLANDS_RESOURCE_DIR) / path).string();
+    }
+};
+
+class Borderlands2CheckTest : public SaveDirectoryTest {
+protected:
+    std::string writeFile(const std::string &name, const std::vector<uint8_t> &data) const {
+        const boost::filesystem::path path = root / name;
+        boost::filesystem::ofstream stream(path, std::ios::out | std::ios::binary);
+        stream.write(reinterpret_cast<const char *>(data.data()), data.size());
+        return path.string();
+    }
+
+    /*!
+     * @brief Builds a save file around LZO compressed data with a valid SHA1 checksum.
+     */
+    static std::vector<uint8_t> wrapCompressed(uint32_t uncompressed_size, const std::vector<uint8_t> &compressed) {
+        std::vector<uint8_t> file(SHA_DIGEST_LENGTH);
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            file.push_back((uint8_t) (uncompressed_size >> shift));
+        }
+        file.insert(file.end(), compressed.begin(), compressed.end());
+        SHA1(file.data() + SHA_DIGEST_LENGTH, file.size() - SHA_DIGEST_LENGTH, file.data());
+        return file;
+    }
+
+    /*!
+     * @brief Builds a save file with valid checksum and compression around the decompressed data.
+     */
+    static std::vector<uint8_t> wrapInner(const std::vector<uint8_t> &inner) {
+        std::vector<uint8_t> compressed(inner.size() + inner.size() / 16 + 64 + 3);
+        std::vector<uint8_t> work_memory(LZO1X_1_MEM_COMPRESS);
+        lzo_uint compressed_size = compressed.size();
+        lzo1x_1_compress(inner.data(), inner.size(), compressed.data(), &compressed_size, work_memory.data());
+        compressed.resize(compressed_size);
+        return wrapCompressed((uint32_t) inner.size(), compressed);
+    }
+
+    /*!
+     * @brief Builds the decompressed data of a save: the WSG header and the Huffman encoded payload.
+     */
+    static std::vector<uint8_t> innerData(const std::string &payload, int32_t uncompressed_size, uint32_t hash) {
+        std::vector<uint8_t> encoded;
+        D4v3::Borderlands::Common::Huffman::encode(payload.data(), (uint32_t) payload.size(), &encoded);
+
+        std::vector<uint8_t> inner;
+        const auto size = (uint32_t) (3 + 4 + 4 + 4 + encoded.size());
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            inner.push_back((uint8_t) (size >> shift));
+        }
+        inner.insert(inner.end(), {'W', 'S', 'G'});
+        for (uint32_t value : {2u, hash, (uint32_t) uncompressed_size}) {
+            for (int shift = 0; shift < 32; shift += 8) {
+                inner.push_back((uint8_t) (value >> shift));
+            }
+        }
+        inner.insert(inner.end(), encoded.begin(), encoded.end());
+        return inner;
+    }
+
+    static uint32_t crc(const std::string &payload) {
+        return D4v3::Borderlands::Common::Checksum::crc32(reinterpret_cast<const uint8_t *>(payload.data()), payload.size());
+    }
+};
+
+class Borderlands2ConcurrencyTest : public SaveDirectoryTest {
+protected:
+    void SetUp() override {
+        SaveDirectoryTest::SetUp();
+
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.packed_weapons = 20;
+        options.missions_per_playthrough = 20;
+        paths = generateSaves(4, options);
+        ASSERT_FALSE(paths.empty());
+
+        // The results of the single threaded reads and writes the concurrent ones have to match.
+        D4v3::Borderlands::Borderlands2::SaveReader reader;
+        D4v3::Borderlands::Borderlands2::SaveWriter writer;
+        for (const std::string &path : paths) {
+            WillowTwoPlayerSaveGame save_game;
+            ASSERT_TRUE(reader.read(path, &save_game));
+            payloads.push_back(reader.payload());
+            encoded.emplace_back();
+            ASSERT_TRUE(writer.encode(save_game, &encoded.back()));
+        }
+    }
+
+    /*!
+     * @brief The save a thread uses in an iteration: even threads all share the first save.
+     */
+    size_t saveIndex(size_t thread, size_t iteration) const {
+        return thread % 2 == 0 ? 0 : (thread + iteration) % paths.size();
+    }
+
+    std::vector<std::string> paths;
+    std::vector<std::vector<uint8_t>> payloads;
+    std::vector<std::vector<uint8_t>> encoded;
 };
 
 TEST_F(Borderlands2Test, VerifySaveFile) {
-    EXPECT_TRUE(verifySave("..\\..\\resources\\76561198034853688\\Save0001.sav"));
+    EXPECT_TRUE(verifySave(resourcePath("76561198034853688/Save0001.sav")));
 }
 
 TEST_F(Borderlands2Test, InvalidPath) {
-    EXPECT_FALSE(verifySave("./../resources/76561198034853688/Save0001.sav"), boost::filesystem::filesystem_error);
-    EXPECT_FALSE(verifySave("./../resources/76561198034853688/Save0001.sav"), boost::filesystem::filesystem_error);
-}
\ No newline at end of file
+    EXPECT_FALSE(verifySave(resourcePath("76561198034853688/Save9999.sav")));
+    EXPECT_FALSE(verifySave(resourcePath("76561198034853688")));
+}
+
+TEST_F(Borderlands2CheckTest, ClassifiesFailures) {
+    using D4v3::Borderlands::Borderlands2::SaveError;
+    D4v3::Borderlands::Borderlands2::SaveReader reader;
+
+    const std::string valid = (root / "Valid.sav").string();
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Generator::generateSaveFile({}, valid));
+    EXPECT_EQ(SaveError::no_error, reader.check(valid));
+    EXPECT_EQ(SaveError::no_error, reader.check(valid, false));
+
+    EXPECT_EQ(SaveError::bad_path, reader.check((root / "Missing.sav").string()));
+    EXPECT_EQ(SaveError::bad_path, reader.check(root.string()));
+    EXPECT_EQ(SaveError::bad_extension, reader.check(writeFile("Save.txt", {1, 2, 3})));
+    EXPECT_EQ(SaveError::truncated, reader.check(writeFile("Short.sav", {1, 2, 3})));
+
+    std::vector<uint8_t> corrupt = wrapInner(innerData("abc", 3, crc("abc")));
+    corrupt.back() ^= 0xFF;
+    EXPECT_EQ(SaveError::sha1_mismatch, reader.check(writeFile("Corrupt.sav", corrupt)));
+
+    const SaveError lzo_error = reader.check(writeFile("Lzo.sav", wrapCompressed(100, {0x11, 0x00, 0x00, 0x7F})));
+    EXPECT_GE(lzo_error, SaveError::lzo_input_overrun);
+    EXPECT_LE(lzo_error, SaveError::lzo_failed);
+
+    std::vector<uint8_t> no_header(32, 'X');
+    EXPECT_EQ(SaveError::bad_inner_header, reader.check(writeFile("Header.sav", wrapInner(no_header))));
+    // The largest size the payload could decode to, the tree takes most of the bits.
+    const auto claimed = (int32_t) (8 * (innerData("abc", 3, 0).size() - 19));
+    EXPECT_EQ(SaveError::huffman_overrun,
+              reader.check(writeFile("Huffman.sav", wrapInner(innerData("abc", claimed, crc("abc"))))));
+    EXPECT_EQ(SaveError::bad_inner_header,
+              reader.check(writeFile("Claimed.sav", wrapInner(innerData("abc", claimed + 1, crc("abc"))))));
+    EXPECT_EQ(SaveError::bad_inner_header,
+              reader.check(writeFile("Huge.sav", wrapInner(innerData("abc", 0x7FFFFFFF, crc("abc"))))));
+    EXPECT_EQ(SaveError::truncated, reader.check(writeFile("Size.sav", wrapCompressed(0xFFFFFFFF, {0x11, 0x00, 0x00}))));
+    EXPECT_EQ(SaveError::inner_hash_mismatch,
+              reader.check(writeFile("Hash.sav", wrapInner(innerData("abc", 3, crc("abc") ^ 1)))));
+
+    const std::string not_a_message("\xFF\xFF\xFF", 3);
+    const std::string unparsable = writeFile("Parse.sav", wrapInner(innerData(not_a_message, 3, crc(not_a_message))));
+    EXPECT_EQ(SaveError::parse_failed, reader.check(unparsable));
+    EXPECT_EQ(SaveError::no_error, reader.check(unparsable, false));
+    EXPECT_FALSE(verifySave(unparsable));
+}
+
+TEST_F(Borderlands2ConcurrencyTest, ReadSavesFromManyThreads) {
+    std::atomic<size_t> failures(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < STRESS_THREADS; ++t) {
+        threads.emplace_back([this, t, &failures]() {
+            D4v3::Borderlands::Borderlands2::SaveReader reader;
+            for (size_t i = 0; i < STRESS_ITERATIONS; ++i) {
+                const size_t save = saveIndex(t, i);
+                WillowTwoPlayerSaveGame save_game;
+                if (!reader.read(paths[save], &save_game) || reader.payload() != payloads[save] ||
+                    !verifySave(paths[save])) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0u, failures.load());
+}
+
+TEST_F(Borderlands2ConcurrencyTest, WriteSavesFromManyThreads) {
+    std::vector<WillowTwoPlayerSaveGame> saves(paths.size());
+    for (size_t save = 0; save < paths.size(); ++save) {
+        ASSERT_TRUE(saves[save].ParseFromArray(payloads[save].data(), (int) payloads[save].size()));
+    }
+
+    std::atomic<size_t> failures(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < STRESS_THREADS; ++t) {
+        threads.emplace_back([this, t, &saves, &failures]() {
+            D4v3::Borderlands::Borderlands2::SaveWriter writer;
+            std::vector<uint8_t> output;
+            for (size_t i = 0; i < STRESS_ITERATIONS; ++i) {
+                const size_t save = saveIndex(t, i);
+                if (!writer.encode(saves[save], &output) || output != encoded[save]) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0u, failures.load());
+}
@@ -0,0 +1,146 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/daemon.hpp>
+#include <borderlands2/json.hpp>
+#include <borderlands2/serial.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+#include "save_directory.hpp"
+
+using D4v3::Borderlands::Borderlands2::Daemon::Request;
+using D4v3::Borderlands::Borderlands2::Daemon::RequestType;
+using D4v3::Borderlands::Borderlands2::Daemon::Response;
+using D4v3::Borderlands::Borderlands2::Daemon::ResponseStatus;
+
+class DaemonTest : public SaveDirectoryTest {
+protected:
+    void SetUp() override {
+        SaveDirectoryTest::SetUp();
+
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.missions_per_playthrough = 10;
+        ASSERT_FALSE(generateSaves(2, options).empty());
+    }
+
+    static Request request(RequestType type, const std::string &payload) {
+        Request result;
+        result.type = type;
+        result.payload = payload;
+        return result;
+    }
+};
+
+TEST_F(DaemonTest, FramesRoundTrip) {
+    const std::string frame = D4v3::Borderlands::Borderlands2::Daemon::encodeFrame(RequestType::json, "abc");
+    ASSERT_EQ(D4v3::Borderlands::Borderlands2::Daemon::frame_header_size + 3, frame.size());
+
+    uint8_t kind = 0;
+    uint32_t payload_size = 0;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Daemon::decodeFrameHeader(
+            reinterpret_cast<const uint8_t *>(frame.data()), &kind, &payload_size));
+    EXPECT_EQ(RequestType::json, kind);
+    EXPECT_EQ(3u, payload_size);
+    EXPECT_EQ("abc", frame.substr(D4v3::Borderlands::Borderlands2::Daemon::frame_header_size));
+
+    const uint8_t empty[] = {0, 0, 0, 0, 1};
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Daemon::decodeFrameHeader(empty, &kind, &payload_size));
+    const uint8_t too_large[] = {0xFF, 0xFF, 0xFF, 0xFF, 1};
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Daemon::decodeFrameHeader(too_large, &kind, &payload_size));
+}
+
+TEST_F(DaemonTest, CacheDecodesEverySaveOnce) {
+    D4v3::Borderlands::Borderlands2::Daemon::SaveCache cache(1);
+
+    const Response summary = cache.handle(request(RequestType::summary, savePath(1).string()));
+    ASSERT_EQ(ResponseStatus::ok, summary.status);
+    EXPECT_NE(std::string::npos, summary.payload.find("ExpLevel="));
+    EXPECT_EQ(ResponseStatus::ok, cache.handle(request(RequestType::verify, savePath(1).string())).status);
+
+    WillowTwoPlayerSaveGame save_game;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::readSave(savePath(1).string(), &save_game));
+    const Response json = cache.handle(request(RequestType::json, savePath(1).string()));
+    EXPECT_EQ(D4v3::Borderlands::Borderlands2::Json::toJson(save_game), json.payload);
+    EXPECT_EQ(1u, cache.misses());
+    EXPECT_EQ(2u, cache.hits());
+
+    // The capacity of one evicts the first save.
+    EXPECT_EQ(ResponseStatus::ok, cache.handle(request(RequestType::summary, savePath(2).string())).status);
+    EXPECT_EQ(ResponseStatus::ok, cache.handle(request(RequestType::summary, savePath(1).string())).status);
+    EXPECT_EQ(3u, cache.misses());
+
+    EXPECT_EQ(ResponseStatus::failed, cache.handle(request(RequestType::verify, savePath(3).string())).status);
+    EXPECT_EQ(ResponseStatus::bad_request, cache.handle(request((RequestType) 42, savePath(1).string())).status);
+}
+
+TEST_F(DaemonTest, ServeRequestsOverSocket) {
+    const std::string socket_path = (root / "daemon.sock").string();
+    D4v3::Borderlands::Borderlands2::Daemon::Server server(socket_path);
+    ASSERT_TRUE(server.listen());
+    EXPECT_EQ(boost::filesystem::owner_read | boost::filesystem::owner_write,
+              boost::filesystem::status(socket_path).permissions());
+    std::thread serving([&server]() { server.run(); });
+
+    D4v3::Borderlands::Borderlands2::Daemon::Client client(socket_path);
+    ASSERT_TRUE(client.connect());
+
+    Response response;
+    ASSERT_TRUE(client.request(request(RequestType::summary, savePath(1).string()), &response));
+    EXPECT_EQ(ResponseStatus::ok, response.status);
+    EXPECT_NE(std::string::npos, response.payload.find("PlayerClass="));
+
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    decoded.is_weapon = true;
+    decoded.seed = 1234;
+    decoded.asset_data.assign(D4v3::Borderlands::Borderlands2::Serial::serial_length - 7, 0);
+    const std::string serial = D4v3::Borderlands::Borderlands2::Serial::encodeSerial(decoded);
+    ASSERT_TRUE(client.request(request(RequestType::serial, serial), &response));
+    EXPECT_EQ(ResponseStatus::ok, response.status);
+    EXPECT_NE(std::string::npos, response.payload.find("Seed=1234\n"));
+
+    ASSERT_TRUE(client.request(request(RequestType::serial, ""), &response));
+    EXPECT_EQ(ResponseStatus::failed, response.status);
+
+    server.stop();
+    serving.join();
+}
+
+TEST_F(DaemonTest, FailingRequestsKeepServing) {
+    const std::string socket_path = (root / "daemon.sock").string();
+    D4v3::Borderlands::Borderlands2::Daemon::Server server(socket_path, [](const Request &request) {
+        if (request.payload == "throw") {
+            throw std::bad_alloc();
+        }
+        Response response;
+        response.payload = request.payload;
+        return response;
+    });
+    ASSERT_TRUE(server.listen());
+    std::thread serving([&server]() { server.run(); });
+
+    D4v3::Borderlands::Borderlands2::Daemon::Client client(socket_path);
+    ASSERT_TRUE(client.connect());
+
+    Response response;
+    ASSERT_TRUE(client.request(request(RequestType::summary, "throw"), &response));
+    EXPECT_EQ(ResponseStatus::failed, response.status);
+
+    // Both the connection and the server survive the failed request.
+    ASSERT_TRUE(client.request(request(RequestType::summary, "echo"), &response));
+    EXPECT_EQ(ResponseStatus::ok, response.status);
+    EXPECT_EQ("echo", response.payload);
+
+    D4v3::Borderlands::Borderlands2::Daemon::Client other(socket_path);
+    ASSERT_TRUE(other.connect());
+    ASSERT_TRUE(other.request(request(RequestType::summary, "other"), &response));
+    EXPECT_EQ("other", response.payload);
+
+    server.stop();
+    serving.join();
+}
@@ -0,0 +1,126 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <borderlands2/diff.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using D4v3::Borderlands::Borderlands2::Diff::Change;
+using D4v3::Borderlands::Borderlands2::Diff::ChangeKind;
+using D4v3::Borderlands::Borderlands2::Diff::diffSaves;
+
+class DiffTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.packed_weapons = 4;
+        options.missions_per_playthrough = 3;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &old_save);
+        new_save = old_save;
+    }
+
+    static std::string toHex(const std::string &bytes) {
+        std::string hex;
+        char digits[3];
+        for (unsigned char byte : bytes) {
+            snprintf(digits, sizeof(digits), "%02x", byte);
+            hex += digits;
+        }
+        return hex;
+    }
+
+    WillowTwoPlayerSaveGame old_save;
+    WillowTwoPlayerSaveGame new_save;
+    std::vector<Change> changes;
+};
+
+TEST_F(DiffTest, EqualSaves) {
+    diffSaves(old_save, new_save, &changes);
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST_F(DiffTest, ChangedScalar) {
+    new_save.set_explevel(50);
+    diffSaves(old_save, new_save, &changes);
+
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ(ChangeKind::changed, changes[0].kind);
+    EXPECT_EQ("ExpLevel", changes[0].path);
+    EXPECT_EQ("72", changes[0].old_value);
+    EXPECT_EQ("50", changes[0].new_value);
+    EXPECT_EQ("~ ExpLevel: 72 -> 50\n", D4v3::Borderlands::Borderlands2::Diff::formatChanges(changes));
+}
+
+TEST_F(DiffTest, RemovedItemIsAlignedBySerial) {
+    const std::string serial = old_save.packedweapondata(0).inventoryserialnumber();
+    new_save.mutable_packedweapondata()->DeleteSubrange(0, 1);
+    diffSaves(old_save, new_save, &changes);
+
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ(ChangeKind::removed, changes[0].kind);
+    EXPECT_EQ("PackedWeaponData[" + toHex(serial) + "]", changes[0].path);
+    ASSERT_EQ(1u, changes[0].old_path.size());
+    EXPECT_EQ(54, changes[0].old_path[0].field_number);
+    EXPECT_EQ(0, changes[0].old_path[0].index);
+    EXPECT_TRUE(changes[0].new_path.empty());
+}
+
+TEST_F(DiffTest, ReorderedMissionsAreAlignedByName) {
+    MissionPlaythroughData *playthrough = new_save.mutable_missionplaythroughs(0);
+    playthrough->mutable_missiondata()->SwapElements(0, 1);
+    const MissionStatus status = playthrough->missiondata(0).status() == MissionStatus::Failed ? MissionStatus::Active : MissionStatus::Failed;
+    playthrough->mutable_missiondata(0)->set_status(status);
+    diffSaves(old_save, new_save, &changes);
+
+    const MissionData &mission = new_save.missionplaythroughs(0).missiondata(0);
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ(ChangeKind::changed, changes[0].kind);
+    EXPECT_EQ("MissionPlaythroughs[" + std::to_string(playthrough->playthroughnumber()) + "].MissionData[" +
+              mission.mission() + "].Status", changes[0].path);
+    EXPECT_EQ(MissionStatus_Name(status), changes[0].new_value);
+    ASSERT_EQ(3u, changes[0].new_path.size());
+    EXPECT_EQ(0, changes[0].new_path[1].index);
+    EXPECT_EQ(1, changes[0].old_path[1].index);
+}
+
+TEST_F(DiffTest, AddedSkillAndDuplicateItems) {
+    SkillData *skill = new_save.add_skilldata();
+    skill->set_skill("GD_Skill.New");
+    skill->set_grade(1);
+    skill->set_gradepoints(0);
+    skill->set_equippedslotindex(0);
+    *new_save.add_packedweapondata() = old_save.packedweapondata(2);
+    diffSaves(old_save, new_save, &changes);
+
+    ASSERT_EQ(2u, changes.size());
+    EXPECT_EQ(ChangeKind::added, changes[0].kind);
+    EXPECT_EQ("SkillData[GD_Skill.New]", changes[0].path);
+    EXPECT_EQ("{Skill: \"GD_Skill.New\", Grade: 1, GradePoints: 0, EquippedSlotIndex: 0}", changes[0].new_value);
+    EXPECT_EQ(ChangeKind::added, changes[1].kind);
+    EXPECT_EQ("PackedWeaponData[" + toHex(old_save.packedweapondata(2).inventoryserialnumber()) + "#1]",
+              changes[1].path);
+    EXPECT_EQ(4, changes[1].new_path[0].index);
+}
+
+TEST_F(DiffTest, EditsTurnOldIntoNewSave) {
+    new_save.set_explevel(10);
+    new_save.mutable_packedweapondata()->DeleteSubrange(1, 1);
+    *new_save.add_packedweapondata() = old_save.packedweapondata(0);
+    new_save.mutable_packedweapondata(0)->set_mark(PlayerMark::Trash);
+    new_save.mutable_missionplaythroughs(0)->mutable_missiondata()->SwapElements(0, 2);
+    new_save.mutable_uipreferences()->set_charactername("Diffed");
+
+    std::vector<D4v3::Borderlands::Borderlands2::Edit::FieldEdit> edits;
+    D4v3::Borderlands::Borderlands2::Diff::diffEdits(old_save, new_save, &edits);
+
+    WillowTwoPlayerSaveGame edited = old_save;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Edit::applyEdits(edits, &edited));
+    EXPECT_EQ(new_save.SerializeAsString(), edited.SerializeAsString());
+
+    for (auto edit = edits.rbegin(); edit != edits.rend(); ++edit) {
+        ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Edit::applyEdit(*edit, &edited, true));
+    }
+    EXPECT_EQ(old_save.SerializeAsString(), edited.SerializeAsString());
+}
@@ -0,0 +1,106 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <borderlands2/dlc.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using D4v3::Borderlands::Borderlands2::Dlc::ExpansionDecoders;
+using D4v3::Borderlands::Borderlands2::Dlc::Expansions;
+
+class DlcTest : public ::testing::Test {
+protected:
+    /*!
+     * @brief Decoded data of the test tag: the bytes of the data.
+     */
+    struct ByteList {
+        std::vector<uint8_t> bytes;
+    };
+
+    void SetUp() override {
+        auto save = std::make_shared<WillowTwoPlayerSaveGame>();
+        D4v3::Borderlands::Borderlands2::Generator::generateSave({}, save.get());
+        addExpansion(save.get(), 3, std::string("\x01\x02\x03", 3));
+        addExpansion(save.get(), 5, std::string());
+        addExpansion(save.get(), 7, "unused");
+        save_game = save;
+        mutable_save = save.get();
+
+        auto registry = std::make_shared<ExpansionDecoders>();
+        registry->add<ByteList>(3, [this](const std::string &data, ByteList *decoded) {
+            ++decode_calls;
+            decoded->bytes.assign(data.begin(), data.end());
+            return true;
+        });
+        registry->add<ByteList>(5, [this](const std::string &data, ByteList *) {
+            ++decode_calls;
+            return !data.empty();
+        });
+        decoders = registry;
+    }
+
+    static void addExpansion(WillowTwoPlayerSaveGame *save, int32_t tag, const std::string &data) {
+        DLCExpansionData *expansion = save->add_dlcexpansiondata();
+        expansion->set_tag(tag);
+        expansion->set_data(data);
+    }
+
+    std::shared_ptr<const WillowTwoPlayerSaveGame> save_game;
+    WillowTwoPlayerSaveGame *mutable_save = nullptr;
+    std::shared_ptr<const ExpansionDecoders> decoders;
+    int decode_calls = 0;
+};
+
+TEST_F(DlcTest, DataIsDecodedOnceOnRequest) {
+    Expansions expansions(save_game, decoders);
+    EXPECT_EQ((std::vector<int32_t>{3, 5, 7}), expansions.tags());
+    EXPECT_EQ(0, decode_calls);
+
+    auto first = expansions.get<ByteList>(3);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ((std::vector<uint8_t>{1, 2, 3}), first->bytes);
+    EXPECT_EQ(first, expansions.get<ByteList>(3));
+    EXPECT_EQ(1, decode_calls);
+
+}
+
+TEST_F(DlcTest, EditedDataIsDecodedAgain) {
+    Expansions expansions(save_game, decoders);
+    auto first = expansions.get<ByteList>(3);
+    ASSERT_NE(nullptr, first);
+
+    mutable_save->mutable_dlcexpansiondata(0)->set_data(std::string("\x04\x05", 2));
+    auto edited = expansions.get<ByteList>(3);
+    ASSERT_NE(nullptr, edited);
+    EXPECT_EQ((std::vector<uint8_t>{4, 5}), edited->bytes);
+    EXPECT_EQ((std::vector<uint8_t>{1, 2, 3}), first->bytes);
+    EXPECT_EQ(edited, expansions.get<ByteList>(3));
+    EXPECT_EQ(2, decode_calls);
+
+    mutable_save->mutable_dlcexpansiondata(1)->set_data("x");
+    EXPECT_NE(nullptr, expansions.get<ByteList>(5));
+    EXPECT_EQ(3, decode_calls);
+
+    mutable_save->mutable_dlcexpansiondata()->DeleteSubrange(0, 1);
+    EXPECT_EQ(nullptr, expansions.get<ByteList>(3));
+}
+
+TEST_F(DlcTest, UnknownTagsAndFailuresAreEmpty) {
+    Expansions expansions(save_game, decoders);
+    EXPECT_TRUE(decoders->knows(5));
+    EXPECT_FALSE(decoders->knows(7));
+
+    EXPECT_EQ(nullptr, expansions.get<ByteList>(5));
+    EXPECT_EQ(nullptr, expansions.get<ByteList>(5));
+    EXPECT_EQ(1, decode_calls);
+
+    EXPECT_EQ(nullptr, expansions.get<ByteList>(7));
+    ASSERT_NE(nullptr, expansions.data(7));
+    EXPECT_EQ("unused", *expansions.data(7));
+    EXPECT_EQ(nullptr, expansions.data(9));
+
+    EXPECT_EQ(nullptr, expansions.get<std::string>(3));
+    EXPECT_EQ(1, decode_calls);
+}
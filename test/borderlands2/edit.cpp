@@ -0,0 +1,123 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/edit.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using D4v3::Borderlands::Borderlands2::Edit::EditHistory;
+using D4v3::Borderlands::Borderlands2::Edit::FieldPath;
+using D4v3::Borderlands::Borderlands2::Edit::FieldValue;
+
+class EditTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.packed_weapons = 4;
+        options.missions_per_playthrough = 3;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &save_game);
+    }
+
+    static FieldValue integer(int64_t value) {
+        FieldValue field_value;
+        field_value.integer = value;
+        return field_value;
+    }
+
+    WillowTwoPlayerSaveGame save_game;
+};
+
+TEST_F(EditTest, SetUndoRedo) {
+    EditHistory history(&save_game);
+    const FieldPath level = {{2, -1}};
+
+    ASSERT_TRUE(history.set(level, integer(50)));
+    EXPECT_EQ(50, save_game.explevel());
+    EXPECT_TRUE(history.canUndo());
+    EXPECT_FALSE(history.canRedo());
+
+    ASSERT_TRUE(history.undo());
+    EXPECT_EQ(72, save_game.explevel());
+    EXPECT_TRUE(history.canRedo());
+
+    ASSERT_TRUE(history.redo());
+    EXPECT_EQ(50, save_game.explevel());
+    EXPECT_EQ(1u, history.edits().size());
+}
+
+TEST_F(EditTest, SetNestedRepeatedField) {
+    EditHistory history(&save_game);
+    const FieldPath status = {{18, 0}, {3, 1}, {2, -1}};
+    const MissionStatus previous = save_game.missionplaythroughs(0).missiondata(1).status();
+
+    ASSERT_TRUE(history.set(status, integer(MissionStatus::Complete)));
+    EXPECT_EQ(MissionStatus::Complete, save_game.missionplaythroughs(0).missiondata(1).status());
+
+    ASSERT_TRUE(history.undo());
+    EXPECT_EQ(previous, save_game.missionplaythroughs(0).missiondata(1).status());
+}
+
+TEST_F(EditTest, InsertAndRemoveElements) {
+    EditHistory history(&save_game);
+    const std::string second = save_game.packedweapondata(1).SerializeAsString();
+
+    PackedWeaponData weapon;
+    weapon.set_inventoryserialnumber("serial");
+    weapon.set_quickslot(QuickWeaponSlot::None);
+    weapon.set_mark(PlayerMark::Favorite);
+    FieldValue value;
+    value.bytes = weapon.SerializeAsString();
+
+    ASSERT_TRUE(history.insert({{54, 1}}, value));
+    ASSERT_EQ(5, save_game.packedweapondata_size());
+    EXPECT_EQ("serial", save_game.packedweapondata(1).inventoryserialnumber());
+    EXPECT_EQ(second, save_game.packedweapondata(2).SerializeAsString());
+
+    ASSERT_TRUE(history.remove({{54, 2}}));
+    ASSERT_EQ(4, save_game.packedweapondata_size());
+
+    ASSERT_TRUE(history.undo());
+    ASSERT_TRUE(history.undo());
+    ASSERT_EQ(4, save_game.packedweapondata_size());
+    EXPECT_EQ(second, save_game.packedweapondata(1).SerializeAsString());
+}
+
+TEST_F(EditTest, InvalidPathsAreRejected) {
+    EditHistory history(&save_game);
+    const std::string before = save_game.SerializeAsString();
+
+    EXPECT_FALSE(history.set({{2, 0}}, integer(1)));
+    EXPECT_FALSE(history.set({{54, 4}, {3, -1}}, integer(PlayerMark::Trash)));
+    EXPECT_FALSE(history.set({{54, 0}, {3, -1}}, integer(17)));
+    EXPECT_FALSE(history.insert({{54, 6}}, FieldValue()));
+    EXPECT_FALSE(history.remove({{2, -1}}));
+    EXPECT_FALSE(history.set({{9999, -1}}, integer(1)));
+
+    EXPECT_FALSE(history.canUndo());
+    EXPECT_EQ(before, save_game.SerializeAsString());
+}
+
+TEST_F(EditTest, ReplayOntoOriginalSave) {
+    boost::filesystem::path original = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.sav");
+    boost::filesystem::path edited = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.sav");
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::writeSave(save_game, original.string()));
+
+    EditHistory history(&save_game);
+    ASSERT_TRUE(history.set({{2, -1}}, integer(10)));
+    ASSERT_TRUE(history.remove({{54, 0}}));
+    ASSERT_TRUE(history.set({{19, -1}, {1, -1}}, [] { FieldValue name; name.bytes = "Edited"; return name; }()));
+
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Edit::replaySave(original.string(), history.edits(), edited.string()));
+
+    WillowTwoPlayerSaveGame replayed;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::readSave(edited.string(), &replayed));
+    EXPECT_EQ(save_game.SerializeAsString(), replayed.SerializeAsString());
+    EXPECT_EQ("Edited", replayed.uipreferences().charactername());
+
+    boost::filesystem::remove(original);
+    boost::filesystem::remove(edited);
+}
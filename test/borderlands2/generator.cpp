@@ -0,0 +1,128 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+class GeneratorTest : public ::testing::Test {
+protected:
+    GeneratorTest() {
+        // You can do set-up work for each test here.
+    }
+
+    ~GeneratorTest() override {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    void SetUp() override {
+        save_path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.sav");
+    }
+
+    void TearDown() override {
+        boost::filesystem::remove(save_path);
+    }
+
+    boost::filesystem::path save_path;
+};
+
+TEST_F(GeneratorTest, GenerateIsDeterministic) {
+    D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+    options.bank_slots = 10;
+    options.packed_weapons = 10;
+
+    WillowTwoPlayerSaveGame first;
+    WillowTwoPlayerSaveGame second;
+    D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &first);
+    D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &second);
+
+    EXPECT_TRUE(first.IsInitialized());
+    EXPECT_EQ(first.SerializeAsString(), second.SerializeAsString());
+}
+
+TEST_F(GeneratorTest, WriteAndReadLargeSave) {
+    D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+    options.bank_slots = 400;
+    options.packed_weapons = 400;
+    options.packed_items = 400;
+    options.mission_playthroughs = 3;
+    options.missions_per_playthrough = 300;
+    options.challenges = 500;
+
+    WillowTwoPlayerSaveGame generated;
+    D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &generated);
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::writeSave(generated, save_path.string()));
+
+    EXPECT_TRUE(verifySave(save_path.string()));
+
+    WillowTwoPlayerSaveGame loaded;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::readSave(save_path.string(), &loaded));
+    EXPECT_EQ(400, loaded.bankslots_size());
+    EXPECT_EQ(400, loaded.packedweapondata_size());
+    EXPECT_EQ(400, loaded.packeditemdata_size());
+    EXPECT_EQ(3, loaded.missionplaythroughs_size());
+    EXPECT_EQ(300, loaded.missionplaythroughs(2).missiondata_size());
+    EXPECT_EQ(generated.SerializeAsString(), loaded.SerializeAsString());
+}
+
+TEST_F(GeneratorTest, EncodeRejectsIncompleteSave) {
+    WillowTwoPlayerSaveGame incomplete;
+    std::vector<uint8_t> data;
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::encodeSave(incomplete, &data));
+}
+
+TEST_F(GeneratorTest, WriteAndReadBigEndianSave) {
+    D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+    options.packed_items = 20;
+
+    WillowTwoPlayerSaveGame generated;
+    D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &generated);
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::writeSave(generated, save_path.string(),
+                                                           D4v3::Borderlands::Common::Streams::Endian::big_endian));
+
+    WillowTwoPlayerSaveGame loaded;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::readSave(save_path.string(), &loaded));
+    EXPECT_EQ(generated.SerializeAsString(), loaded.SerializeAsString());
+}
+
+TEST_F(GeneratorTest, CorruptedSaveIsRejected) {
+    D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+    options.bank_slots = 2000;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Generator::generateSaveFile(options, save_path.string()));
+
+    // Flip a byte behind the first read block of the file.
+    {
+        boost::filesystem::fstream stream(save_path, std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekg(70000);
+        char byte = 0;
+        stream.read(&byte, 1);
+        stream.seekp(70000);
+        byte = (char) ~byte;
+        stream.write(&byte, 1);
+    }
+
+    EXPECT_FALSE(verifySave(save_path.string()));
+}
+
+TEST_F(GeneratorTest, ReadReportsStagesInOrder) {
+    D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Generator::generateSaveFile(options, save_path.string()));
+
+    std::vector<D4v3::Borderlands::Borderlands2::LoadStage> stages;
+    WillowTwoPlayerSaveGame loaded;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::readSave(save_path.string(), &loaded,
+            [&stages](D4v3::Borderlands::Borderlands2::LoadStage stage) { stages.push_back(stage); }));
+
+    const std::vector<D4v3::Borderlands::Borderlands2::LoadStage> expected = {
+            D4v3::Borderlands::Borderlands2::LoadStage::reading_file,
+            D4v3::Borderlands::Borderlands2::LoadStage::decompressing,
+            D4v3::Borderlands::Borderlands2::LoadStage::huffman_decoding,
+            D4v3::Borderlands::Borderlands2::LoadStage::parsing,
+            D4v3::Borderlands::Borderlands2::LoadStage::finished
+    };
+    EXPECT_EQ(expected, stages);
+}
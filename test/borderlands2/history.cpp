@@ -0,0 +1,160 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/history.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using D4v3::Borderlands::Borderlands2::History::VersionStore;
+
+class HistoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.packed_weapons = 6;
+        options.missions_per_playthrough = 4;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &save_game);
+
+        path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.bl2v");
+    }
+
+    void TearDown() override {
+        boost::filesystem::remove(path);
+    }
+
+    /*!
+     * @brief Appends versions with a change to the save between each of them.
+     */
+    void appendVersions(VersionStore *store, int count) {
+        for (int i = 0; i < count; ++i) {
+            save_game.set_explevel(save_game.explevel() + 1);
+            if (i % 3 == 1 && save_game.packedweapondata_size() > 0) {
+                save_game.mutable_packedweapondata()->DeleteSubrange(0, 1);
+            }
+            if (i % 4 == 2) {
+                MissionData *mission = save_game.mutable_missionplaythroughs(0)->mutable_missiondata(i % 4);
+                mission->set_status(MissionStatus::Complete);
+            }
+            ASSERT_TRUE(store->append(save_game));
+            versions.push_back(save_game.SerializeAsString());
+        }
+    }
+
+    WillowTwoPlayerSaveGame save_game;
+    boost::filesystem::path path;
+    std::vector<std::string> versions;
+};
+
+TEST_F(HistoryTest, ReadEveryVersion) {
+    VersionStore store(path.string(), 4);
+    ASSERT_TRUE(store.open());
+    appendVersions(&store, 10);
+
+    ASSERT_EQ(10u, store.size());
+    EXPECT_TRUE(store.isBase(0));
+    EXPECT_FALSE(store.isBase(1));
+    EXPECT_TRUE(store.isBase(4));
+    EXPECT_TRUE(store.isBase(8));
+
+    WillowTwoPlayerSaveGame version;
+    for (size_t i = 0; i < versions.size(); ++i) {
+        ASSERT_TRUE(store.read(i, &version));
+        EXPECT_EQ(versions[i], version.SerializeAsString());
+    }
+    EXPECT_FALSE(store.read(10, &version));
+}
+
+TEST_F(HistoryTest, DeltasAreSmallerThanCopies) {
+    VersionStore store(path.string());
+    ASSERT_TRUE(store.open());
+    appendVersions(&store, 10);
+
+    EXPECT_LT(boost::filesystem::file_size(path), 2 * versions.front().size());
+}
+
+TEST_F(HistoryTest, ReopenAndAppend) {
+    {
+        VersionStore store(path.string(), 4);
+        ASSERT_TRUE(store.open());
+        appendVersions(&store, 5);
+    }
+
+    VersionStore store(path.string(), 4);
+    ASSERT_TRUE(store.open());
+    ASSERT_EQ(5u, store.size());
+    appendVersions(&store, 2);
+
+    WillowTwoPlayerSaveGame version;
+    ASSERT_TRUE(store.read(6, &version));
+    EXPECT_EQ(versions[6], version.SerializeAsString());
+    ASSERT_TRUE(store.read(2, &version));
+    EXPECT_EQ(versions[2], version.SerializeAsString());
+}
+
+TEST_F(HistoryTest, IncompleteRecordIsDropped) {
+    {
+        VersionStore store(path.string());
+        ASSERT_TRUE(store.open());
+        appendVersions(&store, 3);
+    }
+    {
+        boost::filesystem::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::app);
+        stream.write("\x01\xFF\x00\x00\x00\x01", 6);
+    }
+
+    VersionStore store(path.string());
+    ASSERT_TRUE(store.open());
+    ASSERT_EQ(3u, store.size());
+    appendVersions(&store, 1);
+
+    WillowTwoPlayerSaveGame version;
+    ASSERT_TRUE(store.read(3, &version));
+    EXPECT_EQ(versions[3], version.SerializeAsString());
+}
+
+TEST_F(HistoryTest, RejectsOtherFiles) {
+    {
+        boost::filesystem::ofstream stream(path, std::ios::out | std::ios::binary);
+        stream << "WSG";
+    }
+    VersionStore store(path.string());
+    EXPECT_FALSE(store.open());
+}
+
+TEST_F(HistoryTest, AppendRequiresOpen) {
+    VersionStore store(path.string());
+    EXPECT_FALSE(store.append(save_game));
+    EXPECT_FALSE(boost::filesystem::exists(path));
+
+    {
+        boost::filesystem::ofstream stream(path, std::ios::out | std::ios::binary);
+        stream << "WSG";
+    }
+    EXPECT_FALSE(store.open());
+    EXPECT_FALSE(store.append(save_game));
+    EXPECT_EQ(3u, boost::filesystem::file_size(path));
+}
+
+TEST_F(HistoryTest, AppendOverwritesFailedWrite) {
+    VersionStore store(path.string());
+    ASSERT_TRUE(store.open());
+    appendVersions(&store, 2);
+
+    // The remains of an append that failed after it wrote part of its record.
+    {
+        boost::filesystem::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::app);
+        stream.write("\x01\xFF\x00\x00\x00\x01", 6);
+    }
+    appendVersions(&store, 1);
+
+    VersionStore reopened(path.string());
+    ASSERT_TRUE(reopened.open());
+    ASSERT_EQ(3u, reopened.size());
+    WillowTwoPlayerSaveGame version;
+    ASSERT_TRUE(reopened.read(2, &version));
+    EXPECT_EQ(versions[2], version.SerializeAsString());
+}
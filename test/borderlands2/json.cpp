@@ -0,0 +1,166 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <google/protobuf/arena.h>
+#include <rapidjson/document.h>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/json.hpp>
+#include <borderlands2/serial.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+class JsonTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.packed_weapons = 6;
+        options.missions_per_playthrough = 4;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &save_game);
+    }
+
+    /*!
+     * @brief Replaces the save with one of roughly the size of a late game save.
+     */
+    void generateLargeSave() {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.bank_slots = 200;
+        options.packed_weapons = 400;
+        options.packed_items = 400;
+        options.mission_playthroughs = 3;
+        options.missions_per_playthrough = 150;
+        options.challenges = 500;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &save_game);
+    }
+
+    WillowTwoPlayerSaveGame save_game;
+};
+
+TEST_F(JsonTest, ExportsFieldsAndDecodedSerials) {
+    rapidjson::Document document;
+    document.Parse(D4v3::Borderlands::Borderlands2::Json::toJson(save_game).c_str());
+    ASSERT_FALSE(document.HasParseError());
+    ASSERT_TRUE(document.IsObject());
+
+    EXPECT_EQ(save_game.explevel(), document["ExpLevel"].GetInt());
+    EXPECT_STREQ(save_game.playerclass().c_str(), document["PlayerClass"].GetString());
+
+    const rapidjson::Value &missions = document["MissionPlaythroughs"][0]["MissionData"];
+    ASSERT_TRUE(missions.IsArray());
+    ASSERT_EQ((rapidjson::SizeType) save_game.missionplaythroughs(0).missiondata_size(), missions.Size());
+    EXPECT_STREQ(MissionStatus_Name(save_game.missionplaythroughs(0).missiondata(0).status()).c_str(),
+                 missions[0]["Status"].GetString());
+
+    const rapidjson::Value &weapons = document["PackedWeaponData"];
+    ASSERT_EQ((rapidjson::SizeType) save_game.packedweapondata_size(), weapons.Size());
+    for (rapidjson::SizeType i = 0; i < weapons.Size(); ++i) {
+        D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+        ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(
+                save_game.packedweapondata(i).inventoryserialnumber(), &decoded));
+
+        ASSERT_TRUE(weapons[i].HasMember("InventorySerial"));
+        const rapidjson::Value &serial = weapons[i]["InventorySerial"];
+        EXPECT_TRUE(serial["IsWeapon"].GetBool());
+        EXPECT_EQ(decoded.seed, serial["Seed"].GetUint());
+        EXPECT_EQ(2 * D4v3::Borderlands::Borderlands2::Serial::serial_length,
+                  weapons[i]["InventorySerialNumber"].GetStringLength());
+    }
+}
+
+TEST_F(JsonTest, FileMatchesString) {
+    boost::filesystem::path path =
+            boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.json");
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Json::exportJson(save_game, path.string()));
+
+    boost::filesystem::ifstream stream(path, std::ios::in | std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    stream.close();
+    boost::filesystem::remove(path);
+
+    EXPECT_EQ(D4v3::Borderlands::Borderlands2::Json::toJson(save_game), contents);
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::exportJson(save_game, (path / "missing.json").string()));
+}
+
+TEST_F(JsonTest, ImportRestoresExportedSave) {
+    google::protobuf::Arena arena;
+    auto *imported = google::protobuf::Arena::CreateMessage<WillowTwoPlayerSaveGame>(&arena);
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Json::fromJson(
+            D4v3::Borderlands::Borderlands2::Json::toJson(save_game), imported));
+    EXPECT_EQ(save_game.SerializeAsString(), imported->SerializeAsString());
+
+    boost::filesystem::path path =
+            boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%.json");
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Json::exportJson(save_game, path.string()));
+    WillowTwoPlayerSaveGame from_file;
+    EXPECT_TRUE(D4v3::Borderlands::Borderlands2::Json::importJson(path.string(), &from_file));
+    boost::filesystem::remove(path);
+    EXPECT_EQ(save_game.SerializeAsString(), from_file.SerializeAsString());
+}
+
+TEST_F(JsonTest, ImportRejectsInvalidSaves) {
+    const std::string json = D4v3::Borderlands::Borderlands2::Json::toJson(save_game);
+    const std::string player_class = "\"PlayerClass\":\"" + save_game.playerclass() + "\",";
+    ASSERT_NE(std::string::npos, json.find(player_class));
+
+    std::string missing_field = json;
+    missing_field.erase(missing_field.find(player_class), player_class.size());
+    std::string unknown_field = json;
+    unknown_field.insert(1, "\"Unknown\":1,");
+    const std::string level = "\"ExpLevel\":" + std::to_string(save_game.explevel());
+    std::string wrong_type = json;
+    wrong_type.replace(wrong_type.find(level), level.size(), "\"ExpLevel\":\"1\"");
+
+    WillowTwoPlayerSaveGame imported;
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::fromJson(missing_field, &imported));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::fromJson(unknown_field, &imported));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::fromJson(wrong_type, &imported));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::fromJson(json.substr(0, json.size() / 2), &imported));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::fromJson("[]", &imported));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Json::importJson("missing.json", &imported));
+}
+
+TEST_F(JsonTest, LargeSaveRoundTripsThroughArena) {
+    generateLargeSave();
+
+    const std::string json = D4v3::Borderlands::Borderlands2::Json::toJson(save_game);
+    google::protobuf::Arena arena;
+    auto *imported = google::protobuf::Arena::CreateMessage<WillowTwoPlayerSaveGame>(&arena);
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Json::fromJson(json, imported));
+    EXPECT_EQ(save_game.SerializeAsString(), imported->SerializeAsString());
+}
+
+// A benchmark, run with --gtest_also_run_disabled_tests. The rates are recorded as properties of the test.
+TEST_F(JsonTest, DISABLED_ImportThroughput) {
+    generateLargeSave();
+
+    constexpr int iterations = 20;
+    std::string json;
+    const auto export_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        json = D4v3::Borderlands::Borderlands2::Json::toJson(save_game);
+    }
+    const auto export_end = std::chrono::steady_clock::now();
+
+    google::protobuf::Arena arena;
+    std::string imported;
+    for (int i = 0; i < iterations; ++i) {
+        auto *save = google::protobuf::Arena::CreateMessage<WillowTwoPlayerSaveGame>(&arena);
+        ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Json::fromJson(json, save));
+        if (i == iterations - 1) {
+            imported = save->SerializeAsString();
+        }
+        arena.Reset();
+    }
+    const auto import_end = std::chrono::steady_clock::now();
+    EXPECT_EQ(save_game.SerializeAsString(), imported);
+
+    const double megabytes = iterations * json.size() / (1024.0 * 1024.0);
+    const double export_rate = megabytes / std::chrono::duration<double>(export_end - export_start).count();
+    const double import_rate = megabytes / std::chrono::duration<double>(import_end - export_end).count();
+    RecordProperty("json_bytes", std::to_string(json.size()));
+    RecordProperty("export_mb_per_second", std::to_string(export_rate));
+    RecordProperty("import_mb_per_second", std::to_string(import_rate));
+}
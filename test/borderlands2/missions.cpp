@@ -0,0 +1,121 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <limits>
+#include <set>
+#include <gtest/gtest.h>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/missions.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using D4v3::Borderlands::Borderlands2::Missions::MissionIndex;
+using D4v3::Borderlands::Borderlands2::Missions::MissionNames;
+using D4v3::Borderlands::Borderlands2::Missions::MissionSet;
+
+class MissionsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.mission_playthroughs = 3;
+        options.missions_per_playthrough = 40;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &first);
+        options.seed = 2;
+        options.mission_playthroughs = 2;
+        options.missions_per_playthrough = 50;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &second);
+    }
+
+    /*!
+     * @brief Returns the missions of a playthrough with a status by comparing the names.
+     */
+    static std::set<std::string> missionsWithStatus(const WillowTwoPlayerSaveGame &save_game, int playthrough,
+                                                    MissionStatus status) {
+        std::set<std::string> missions;
+        for (const auto &mission : save_game.missionplaythroughs(playthrough).missiondata()) {
+            if (mission.status() == status) {
+                missions.insert(mission.mission());
+            }
+        }
+        return missions;
+    }
+
+    static std::set<std::string> toSet(const std::vector<std::string> &names) {
+        return std::set<std::string>(names.begin(), names.end());
+    }
+
+    WillowTwoPlayerSaveGame first;
+    WillowTwoPlayerSaveGame second;
+};
+
+TEST_F(MissionsTest, StatusSetsMatchMissionData) {
+    MissionIndex index;
+    index.build(first);
+    ASSERT_EQ(3u, index.playthroughCount());
+
+    for (int playthrough = 0; playthrough < 3; ++playthrough) {
+        MissionSet all(index.names()->size());
+        for (int status = 0; status < D4v3::Borderlands::Borderlands2::Missions::status_count; ++status) {
+            MissionSet missions = index.missions((size_t) playthrough, status);
+            EXPECT_EQ(missionsWithStatus(first, playthrough, (MissionStatus) status), toSet(index.missionNames(missions)));
+            EXPECT_FALSE(all.intersects(missions));
+            all |= missions;
+        }
+        EXPECT_EQ(all, index.known((size_t) playthrough));
+        EXPECT_EQ(40u, all.count());
+    }
+
+    const MissionData &mission = first.missionplaythroughs(2).missiondata(7);
+    EXPECT_EQ(mission.status(), index.status(2, mission.mission()));
+    EXPECT_EQ(-1, index.status(2, "GD_Generated.M_Unknown"));
+    EXPECT_EQ(-1, index.status(5, mission.mission()));
+    EXPECT_TRUE(index.missions(5, MissionStatus::Complete).none());
+}
+
+TEST_F(MissionsTest, LastStatusOfDuplicateWins) {
+    MissionData *duplicate = first.mutable_missionplaythroughs(0)->add_missiondata();
+    duplicate->CopyFrom(first.missionplaythroughs(0).missiondata(0));
+    duplicate->set_status(duplicate->status() == MissionStatus::Complete ? MissionStatus::Failed : MissionStatus::Complete);
+
+    MissionIndex index;
+    index.build(first);
+    EXPECT_EQ(duplicate->status(), index.status(0, duplicate->mission()));
+    EXPECT_EQ(40u, index.known(0).count());
+}
+
+TEST_F(MissionsTest, SavesSharingNamesCanBeCombined) {
+    auto names = std::make_shared<MissionNames>();
+    MissionIndex first_index(names);
+    MissionIndex second_index(names);
+    first_index.build(first);
+    second_index.build(second);
+    EXPECT_EQ(50u, names->size());
+
+    // Sets of the first save were built with fewer names, they are resized when they are returned.
+    MissionSet both = first_index.missions(1, MissionStatus::Complete) & second_index.missions(1, MissionStatus::Complete);
+
+    std::set<std::string> expected;
+    const auto first_complete = missionsWithStatus(first, 1, MissionStatus::Complete);
+    for (const auto &mission : missionsWithStatus(second, 1, MissionStatus::Complete)) {
+        if (first_complete.count(mission) > 0) {
+            expected.insert(mission);
+        }
+    }
+    EXPECT_EQ(expected, toSet(first_index.missionNames(both)));
+
+    MissionSet only_second = second_index.known(0) - first_index.known(0);
+    EXPECT_EQ(10u, only_second.count());
+}
+
+TEST_F(MissionsTest, InvalidPlaythroughNumbersUsePosition) {
+    first.mutable_missionplaythroughs(0)->set_playthroughnumber(-1);
+    first.mutable_missionplaythroughs(1)->set_playthroughnumber(std::numeric_limits<int32_t>::max());
+
+    MissionIndex index;
+    index.build(first);
+    ASSERT_EQ(3u, index.playthroughCount());
+    for (int playthrough = 0; playthrough < 3; ++playthrough) {
+        EXPECT_EQ(missionsWithStatus(first, playthrough, MissionStatus::Complete),
+                  toSet(index.missionNames(index.missions((size_t) playthrough, MissionStatus::Complete))));
+    }
+}
@@ -0,0 +1,133 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/query.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+#include "save_directory.hpp"
+
+class QueryTest : public SaveDirectoryTest {
+protected:
+    void SetUp() override {
+        SaveDirectoryTest::SetUp();
+
+        for (uint32_t i = 0; i < 12; ++i) {
+            D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+            options.seed = i + 1;
+            options.missions_per_playthrough = 6;
+            options.packed_weapons = i % 6;
+
+            WillowTwoPlayerSaveGame save_game;
+            D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &save_game);
+            save_game.set_explevel((int32_t) (60 + i));
+            if (i % 3 == 0) {
+                save_game.set_playerclass("GD_Siren_Streaming.Character.CharClass_Mechromancer");
+            } else if (i % 3 == 1) {
+                save_game.set_playerclass("GD_Siren.Character.CharClass_Siren");
+            }
+
+            paths.push_back(savePath(i + 1).string());
+            ASSERT_TRUE(D4v3::Borderlands::Borderlands2::writeSave(save_game, paths.back()));
+            saves.push_back(save_game);
+        }
+    }
+
+    D4v3::Borderlands::Borderlands2::Query::QueryResult run(const std::vector<std::string> &terms) {
+        D4v3::Borderlands::Borderlands2::Query::SaveQuery query;
+        EXPECT_TRUE(D4v3::Borderlands::Borderlands2::Query::parseQuery(terms, &query));
+        D4v3::Borderlands::Borderlands2::Query::QueryResult result;
+        EXPECT_TRUE(D4v3::Borderlands::Borderlands2::Query::runQuery(paths, query, &result, 4));
+        return result;
+    }
+
+    std::vector<std::string> paths;
+    std::vector<WillowTwoPlayerSaveGame> saves;
+};
+
+TEST_F(QueryTest, TopLevelConditionsDoNotParse) {
+    auto result = run({"ExpLevel>=66", "PlayerClass~CharClass_Siren"});
+
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < saves.size(); ++i) {
+        if (saves[i].explevel() >= 66 && saves[i].playerclass().find("CharClass_Siren") != std::string::npos) {
+            expected.push_back(paths[i]);
+        }
+    }
+    EXPECT_EQ(expected, result.matches);
+    EXPECT_EQ(0u, result.parsed);
+    EXPECT_EQ(0u, result.failed);
+
+    result = run({"count:PlayerClass"});
+    EXPECT_EQ(saves.size(), result.matches.size());
+    EXPECT_EQ(4u, result.counts["GD_Siren.Character.CharClass_Siren"]);
+    EXPECT_EQ(4u, result.counts["GD_Assassin.Character.CharClass_Assassin"]);
+    EXPECT_EQ(0u, result.parsed);
+}
+
+TEST_F(QueryTest, MissingMission) {
+    const std::string mission = "GD_Generated.M_Mission_2";
+    auto result = run({"ExpLevel>61", "!MissionData.Mission=" + mission, "!MissionData.Status=Complete"});
+
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < saves.size(); ++i) {
+        bool completed = false;
+        for (const auto &playthrough : saves[i].missionplaythroughs()) {
+            for (const auto &data : playthrough.missiondata()) {
+                completed |= data.mission() == mission && data.status() == MissionStatus::Complete;
+            }
+        }
+        if (saves[i].explevel() > 61 && !completed) {
+            expected.push_back(paths[i]);
+        }
+    }
+    EXPECT_EQ(expected, result.matches);
+    EXPECT_EQ(saves.size() - 2, result.parsed);
+}
+
+TEST_F(QueryTest, CountEquippedWeaponsBySlot) {
+    auto result = run({"PackedWeaponData.QuickSlot!=None", "count:PackedWeaponData.QuickSlot"});
+
+    std::map<std::string, uint64_t> expected;
+    size_t matches = 0;
+    for (const auto &save : saves) {
+        bool equipped = false;
+        for (const auto &weapon : save.packedweapondata()) {
+            if (weapon.quickslot() != QuickWeaponSlot::None) {
+                ++expected[QuickWeaponSlot_Name(weapon.quickslot())];
+                equipped = true;
+            }
+        }
+        matches += equipped ? 1 : 0;
+    }
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(expected, result.counts);
+    EXPECT_EQ(matches, result.matches.size());
+}
+
+TEST_F(QueryTest, UnreadableSavesAreCounted) {
+    boost::filesystem::path broken = savePath(99);
+    boost::filesystem::ofstream(broken) << "not a save";
+    paths.push_back(broken.string());
+    paths.push_back(savePath(100).string());
+
+    auto result = run({"ExpLevel>0"});
+    EXPECT_EQ(saves.size(), result.matches.size());
+    EXPECT_EQ(2u, result.failed);
+}
+
+TEST_F(QueryTest, InvalidQueriesAreRejected) {
+    D4v3::Borderlands::Borderlands2::Query::SaveQuery query;
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"Unknown=1"}, &query));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"ExpLevel"}, &query));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"ExpLevel=high"}, &query));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"!ExpLevel=1"}, &query));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"MissionData.Status=Done"}, &query));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"count:MissionPlaythroughs"}, &query));
+    EXPECT_TRUE(D4v3::Borderlands::Borderlands2::Query::parseQuery({"SkillData.Grade>=5", "count:SkillData.Skill"}, &query));
+}
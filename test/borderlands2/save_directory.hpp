@@ -0,0 +1,68 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#ifndef BORDERLANDSSAVEEDITOR_TEST_SAVE_DIRECTORY_HPP
+#define BORDERLANDSSAVEEDITOR_TEST_SAVE_DIRECTORY_HPP
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <borderlands2/generator.hpp>
+
+/*!
+ * @brief Base of the tests working on save files, every test gets a new temporary directory that is removed after it.
+ */
+class SaveDirectoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%");
+        boost::filesystem::create_directories(root);
+    }
+
+    void TearDown() override {
+        boost::filesystem::remove_all(root);
+    }
+
+    /*!
+     * @brief Returns the path of the save with a number, named like the saves of the game.
+     *
+     * @param[in] save The number of the save.
+     * @param[in] directory The directory of the save, the temporary directory if it is empty.
+     */
+    boost::filesystem::path savePath(uint32_t save, const boost::filesystem::path &directory = {}) const {
+        char name[16];
+        snprintf(name, sizeof(name), "Save%04u.sav", save);
+        return (directory.empty() ? root : directory) / name;
+    }
+
+    /*!
+     * @brief Generates the saves 1 to count, every save uses its number as seed.
+     *
+     * @param[in] count The number of saves.
+     * @param[in] options The options of the saves, the seed is replaced.
+     * @param[in] directory The directory of the saves, the temporary directory if it is empty.
+     * @return The paths of the saves, empty if a save could not be written.
+     */
+    std::vector<std::string> generateSaves(uint32_t count, D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options,
+                                           const boost::filesystem::path &directory = {}) const {
+        std::vector<std::string> paths;
+        for (uint32_t save = 1; save <= count; ++save) {
+            options.seed = save;
+            paths.push_back(savePath(save, directory).string());
+            if (!D4v3::Borderlands::Borderlands2::Generator::generateSaveFile(options, paths.back())) {
+                return {};
+            }
+        }
+        return paths;
+    }
+
+    boost::filesystem::path root;
+};
+
+#endif //BORDERLANDSSAVEEDITOR_TEST_SAVE_DIRECTORY_HPP
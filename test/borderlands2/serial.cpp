@@ -0,0 +1,75 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <borderlands2/serial.hpp>
+
+std::string fromHex(const std::string &hex) {
+    std::string bytes;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+        bytes.push_back((char) std::stoi(hex.substr(i, 2), nullptr, 16));
+    }
+    return bytes;
+}
+
+TEST(SerialTest, DecodeWeapon) {
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    std::string serial = fromHex("878f6b4b0331e4ee41cef9d22a69ab06a5c5d34796e9b465fc354da3db8f18798e44425accf2f1");
+
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(serial, &decoded));
+    EXPECT_TRUE(decoded.is_weapon);
+    EXPECT_EQ(decoded.version, 7);
+    EXPECT_EQ(decoded.seed, 0x8f6b4b03u);
+    EXPECT_EQ(decoded.checksum, 0xf94d);
+    EXPECT_EQ(decoded.asset_library_set_id, 0);
+    EXPECT_EQ(decoded.asset_data.size(), serial.size() - 7);
+}
+
+TEST(SerialTest, DecodeShortItem) {
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    std::string serial = fromHex("073745cf3086127e468ecb2dcc2b090e");
+
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(serial, &decoded));
+    EXPECT_FALSE(decoded.is_weapon);
+    EXPECT_EQ(decoded.seed, 0x3745cf30u);
+    EXPECT_EQ(decoded.asset_data.size(), 9);
+}
+
+TEST(SerialTest, DecodeRejectsCorruptedSerial) {
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    std::string serial = fromHex("878f6b4b0331e4ee41cef9d22a69ab06a5c5d34796e9b465fc354da3db8f18798e44425accf2f1");
+    serial[20] ^= 0x10;
+
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(serial, &decoded));
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(serial.substr(0, 4), &decoded));
+}
+
+TEST(SerialTest, EncodeDecodeRoundTrip) {
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial serial;
+    serial.is_weapon = true;
+    serial.seed = 0xdeadbeef;
+    for (uint8_t i = 0; i < 33; ++i) {
+        serial.asset_data.push_back((uint8_t) (i * 7));
+    }
+
+    std::string encoded = D4v3::Borderlands::Borderlands2::Serial::encodeSerial(serial);
+    ASSERT_EQ(encoded.size(), D4v3::Borderlands::Borderlands2::Serial::serial_length);
+
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(encoded, &decoded));
+    EXPECT_TRUE(decoded.is_weapon);
+    EXPECT_EQ(decoded.seed, serial.seed);
+    EXPECT_EQ(decoded.asset_data, serial.asset_data);
+}
+
+TEST(SerialTest, EncodeUnscrambledSerial) {
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial serial;
+    serial.asset_data = {0x00, 0x11, 0x22};
+
+    std::string encoded = D4v3::Borderlands::Borderlands2::Serial::encodeSerial(serial);
+    EXPECT_EQ(encoded.substr(7), std::string("\x00\x11\x22", 3));
+
+    D4v3::Borderlands::Borderlands2::Serial::DecodedSerial decoded;
+    EXPECT_TRUE(D4v3::Borderlands::Borderlands2::Serial::decodeSerial(encoded, &decoded));
+}
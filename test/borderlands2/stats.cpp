@@ -0,0 +1,119 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <borderlands2/borderlands2.hpp>
+#include <borderlands2/stats.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+using D4v3::Borderlands::Borderlands2::Stats::StatsView;
+
+class StatsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // The first entries of a real StatsData blob.
+        addStat(0x0655, 0x00012981);
+        addStat(0x0656, 0x00006b3d);
+        addStat(0x0755, 0x00000b5b);
+        addStat(0x07e2, -5);
+        blob = buildBlob();
+    }
+
+    void addStat(uint16_t id, int32_t value) {
+        stats.emplace_back(id, value);
+    }
+
+    std::string buildBlob() const {
+        std::string entries;
+        entries.push_back((char) (stats.size() & 0xFF));
+        entries.push_back((char) (stats.size() >> 8));
+        for (const auto &stat : stats) {
+            entries.push_back((char) (stat.first & 0xFF));
+            entries.push_back((char) (stat.first >> 8));
+            entries.push_back(1);
+            for (int shift = 0; shift < 32; shift += 8) {
+                entries.push_back((char) ((uint32_t) stat.second >> shift));
+            }
+            entries.append("\x01\x00\x00\x00\x00", 5);
+        }
+
+        std::string result("\x04\x00\x00\x00", 4);
+        for (int shift = 0; shift < 32; shift += 8) {
+            result.push_back((char) (entries.size() >> shift));
+        }
+        return result + entries;
+    }
+
+    std::vector<std::pair<uint16_t, int32_t>> stats;
+    std::string blob;
+};
+
+TEST_F(StatsTest, LookupStats) {
+    const StatsView view(blob);
+    ASSERT_TRUE(view.valid());
+    EXPECT_EQ(4u, view.size());
+    EXPECT_EQ((std::vector<uint16_t>{0x0655, 0x0656, 0x0755, 0x07e2}), view.ids());
+
+    for (const auto &stat : stats) {
+        int32_t value = 0;
+        EXPECT_TRUE(view.get(stat.first, &value));
+        EXPECT_EQ(stat.second, value);
+    }
+    int32_t value = 0;
+    EXPECT_FALSE(view.get(0x0657, &value));
+}
+
+TEST_F(StatsTest, PatchStatInPlace) {
+    const std::string original = blob;
+    StatsView view(&blob);
+    ASSERT_TRUE(view.set(0x0656, 123456));
+    EXPECT_FALSE(view.set(0x0657, 1));
+
+    int32_t value = 0;
+    EXPECT_TRUE(view.get(0x0656, &value));
+    EXPECT_EQ(123456, value);
+
+    stats[1].second = 123456;
+    EXPECT_EQ(buildBlob(), blob);
+    EXPECT_EQ(original.size(), blob.size());
+
+    StatsView read_only(original);
+    EXPECT_FALSE(read_only.set(0x0656, 1));
+}
+
+TEST_F(StatsTest, MalformedBlobsAreRejected) {
+    EXPECT_FALSE(StatsView(std::string()).valid());
+    EXPECT_FALSE(StatsView(blob.substr(0, blob.size() - 1)).valid());
+
+    std::string wrong_type = blob;
+    wrong_type[8 + 2 + 2] = 2;
+    const StatsView view(wrong_type);
+    EXPECT_FALSE(view.valid());
+    EXPECT_EQ(0u, view.size());
+    int32_t value = 0;
+    EXPECT_FALSE(view.get(0x0655, &value));
+}
+
+TEST_F(StatsTest, StatsOfBundledSave) {
+    WillowTwoPlayerSaveGame save_game;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::readSave(
+            (boost::filesystem::path(BORDERLANDS_RESOURCE_DIR) / "76561198034853688" / "Save0001.sav").string(),
+            &save_game));
+    ASSERT_EQ(4654u, save_game.statsdata().size());
+
+    StatsView view(save_game.mutable_statsdata());
+    ASSERT_TRUE(view.valid());
+    ASSERT_EQ(387u, view.size());
+
+    const uint16_t id = view.ids().front();
+    int32_t original = 0;
+    ASSERT_TRUE(view.get(id, &original));
+    ASSERT_TRUE(view.set(id, original + 1000));
+    int32_t value = 0;
+    EXPECT_TRUE(view.get(id, &value));
+    EXPECT_EQ(original + 1000, value);
+    EXPECT_EQ(4654u, save_game.statsdata().size());
+    EXPECT_EQ(387u, StatsView(save_game.statsdata()).size());
+}
@@ -0,0 +1,105 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <borderlands2/generator.hpp>
+#include <borderlands2/wire_format.hpp>
+#include <borderlands2/WillowTwoPlayerSaveGame.pb.h>
+
+class WireFormatTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        D4v3::Borderlands::Borderlands2::Generator::GeneratorOptions options;
+        options.bank_slots = 5;
+        options.packed_weapons = 7;
+        options.packed_items = 3;
+        options.missions_per_playthrough = 4;
+
+        WillowTwoPlayerSaveGame save_game;
+        D4v3::Borderlands::Borderlands2::Generator::generateSave(options, &save_game);
+        std::string serialized = save_game.SerializeAsString();
+        payload.assign(serialized.begin(), serialized.end());
+    }
+
+    std::vector<uint8_t> payload;
+};
+
+TEST_F(WireFormatTest, TopLevelFieldsCoverPayload) {
+    std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> index;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(payload.data(), payload.size(), &index));
+
+    size_t offset = 0;
+    size_t weapons = 0;
+    for (const auto &span : index) {
+        if (span.parent == -1) {
+            EXPECT_EQ(offset, span.offset);
+            offset = span.end;
+            weapons += span.number == 54 ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(payload.size(), offset);
+    EXPECT_EQ(7u, weapons);
+}
+
+TEST_F(WireFormatTest, NestedFieldsAreInsideTheirParent) {
+    std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> index;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(payload.data(), payload.size(), &index));
+
+    size_t nested = 0;
+    for (size_t i = 0; i < index.size(); ++i) {
+        const auto &span = index[i];
+        EXPECT_LE(span.offset, span.value_offset);
+        EXPECT_LE(span.value_offset, span.end);
+        if (i > 0) {
+            EXPECT_LT(index[i - 1].offset, span.offset);
+        }
+        if (span.parent >= 0) {
+            const auto &parent = index[span.parent];
+            EXPECT_LT((size_t) span.parent, i);
+            EXPECT_GE(span.offset, parent.value_offset);
+            EXPECT_LE(span.end, parent.end);
+            ++nested;
+        }
+    }
+    EXPECT_GT(nested, 0u);
+}
+
+TEST_F(WireFormatTest, TopLevelIndexSkipsNestedFields) {
+    std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> index;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(payload.data(), payload.size(), &index));
+    std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> top_level;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::WireFormat::indexTopLevelFields(payload.data(), payload.size(),
+                                                                                  &top_level));
+
+    size_t next = 0;
+    for (const auto &span : index) {
+        if (span.parent == -1) {
+            ASSERT_LT(next, top_level.size());
+            EXPECT_EQ(span.number, top_level[next].number);
+            EXPECT_EQ(span.offset, top_level[next].offset);
+            EXPECT_EQ(span.end, top_level[next].end);
+            ++next;
+        }
+    }
+    EXPECT_EQ(top_level.size(), next);
+}
+
+TEST_F(WireFormatTest, TruncatedPayloadIsRejected) {
+    std::vector<D4v3::Borderlands::Borderlands2::WireFormat::FieldSpan> index;
+    ASSERT_TRUE(D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(payload.data(), payload.size(), &index));
+
+    // Cut the payload inside the value of the first string field.
+    size_t cut = 0;
+    for (const auto &span : index) {
+        if (span.wire_type == D4v3::Borderlands::Borderlands2::WireFormat::length_delimited &&
+            span.end - span.value_offset > 2) {
+            cut = span.value_offset + 1;
+            break;
+        }
+    }
+    ASSERT_GT(cut, 0u);
+
+    EXPECT_FALSE(D4v3::Borderlands::Borderlands2::WireFormat::indexSaveFields(payload.data(), cut, &index));
+    EXPECT_TRUE(index.empty());
+}
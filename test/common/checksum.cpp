@@ -0,0 +1,65 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <common/common.hpp>
+
+#include <string>
+#include <vector>
+
+class ChecksumTest : public ::testing::Test {
+protected:
+    ChecksumTest() {
+        // You can do set-up work for each test here.
+    }
+
+    ~ChecksumTest() override {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    /*!
+     * @brief Bit wise reference implementation of CRC32.
+     */
+    static uint32_t referenceCrc32(const uint8_t *data, size_t size) {
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < size; ++i) {
+            crc ^= data[i];
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1u) ? (crc >> 1u) ^ 0xEDB88320u : crc >> 1u;
+            }
+        }
+        return ~crc;
+    }
+};
+
+TEST_F(ChecksumTest, Crc32CheckValue) {
+    const std::string input = "123456789";
+    EXPECT_EQ(0xCBF43926u, D4v3::Borderlands::Common::Checksum::crc32(reinterpret_cast<const uint8_t *>(input.data()), input.size()));
+}
+
+TEST_F(ChecksumTest, Crc32Empty) {
+    EXPECT_EQ(0u, D4v3::Borderlands::Common::Checksum::crc32(nullptr, 0));
+}
+
+TEST_F(ChecksumTest, Crc32MatchesReferenceForAllTailLengths) {
+    std::vector<uint8_t> data(1031);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = (uint8_t) (i * 131 + 7);
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t size = 0; size + offset <= 40; ++size) {
+            EXPECT_EQ(referenceCrc32(data.data() + offset, size),
+                      D4v3::Borderlands::Common::Checksum::crc32(data.data() + offset, size));
+        }
+    }
+    EXPECT_EQ(referenceCrc32(data.data(), data.size()), D4v3::Borderlands::Common::Checksum::crc32(data.data(), data.size()));
+}
+
+TEST_F(ChecksumTest, Crc32Incremental) {
+    std::vector<uint8_t> data(100, 0x5A);
+    uint32_t crc = D4v3::Borderlands::Common::Checksum::crc32(data.data(), 37);
+    crc = D4v3::Borderlands::Common::Checksum::crc32(data.data() + 37, data.size() - 37, crc);
+    EXPECT_EQ(D4v3::Borderlands::Common::Checksum::crc32(data.data(), data.size()), crc);
+}
@@ -30,17 +30,123 @@ protected:
 };
 
 TEST_F(StreamTest, ReadUInt32_1) {
-    SUCCEED();
+    const uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, sizeof(data));
+    EXPECT_EQ(0x01020304u, (reader.read<uint32_t, D4v3::Borderlands::Common::Streams::big_endian>()));
+    EXPECT_EQ(0u, reader.remaining());
 }
 
 TEST_F(StreamTest, ReadUInt32_2) {
-    SUCCEED();
+    const uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, sizeof(data));
+    EXPECT_EQ(0x04030201u, (reader.read<uint32_t, D4v3::Borderlands::Common::Streams::little_endian>()));
 }
 
 TEST_F(StreamTest, ReadUInt32_3) {
-    SUCCEED();
+    const uint8_t data[] = {0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0x00, 0x00, 0x00};
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, sizeof(data));
+    EXPECT_EQ(-2, reader.read<int32_t>(D4v3::Borderlands::Common::Streams::big_endian));
+    EXPECT_EQ(2u, reader.read<uint32_t>(D4v3::Borderlands::Common::Streams::little_endian));
 }
 
 TEST_F(StreamTest, ReadUInt32_4) {
-    SUCCEED();
-}
\ No newline at end of file
+    const uint8_t data[] = {0x01, 0x02, 0x03};
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, sizeof(data));
+    EXPECT_THROW((reader.read<uint32_t, D4v3::Borderlands::Common::Streams::big_endian>()), std::out_of_range);
+    EXPECT_EQ(0u, reader.position());
+}
+
+TEST_F(StreamTest, ReadMixedWidths) {
+    const uint8_t data[] = {0x7F, 0x12, 0x34, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, sizeof(data));
+    EXPECT_EQ(0x7F, (reader.read<uint8_t, D4v3::Borderlands::Common::Streams::big_endian>()));
+    EXPECT_EQ(0x3412, (reader.read<uint16_t, D4v3::Borderlands::Common::Streams::little_endian>()));
+    EXPECT_EQ(0x0102030405060708ull, (reader.read<uint64_t, D4v3::Borderlands::Common::Streams::big_endian>()));
+    EXPECT_EQ(sizeof(data), reader.position());
+}
+
+TEST_F(StreamTest, ReadBytes) {
+    const char data[] = "WSG";
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, 3);
+    const uint8_t* magic = reader.read_bytes(3);
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(data), magic);
+    EXPECT_THROW(reader.read_bytes(1), std::out_of_range);
+    EXPECT_THROW(reader.skip(1), std::out_of_range);
+}
+
+TEST_F(StreamTest, ReadVarint) {
+    const uint8_t data[] = {0x08, 0xAC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80};
+    D4v3::Borderlands::Common::Streams::ByteReader reader(data, sizeof(data));
+    EXPECT_EQ(8u, reader.read_varint());
+    EXPECT_EQ(300u, reader.read_varint());
+    EXPECT_EQ(0xFFFFFFFFu, reader.read_varint());
+    EXPECT_THROW(reader.read_varint(), std::out_of_range);
+
+    const uint8_t too_long[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01};
+    D4v3::Borderlands::Common::Streams::ByteReader long_reader(too_long, sizeof(too_long));
+    EXPECT_THROW(long_reader.read_varint(), std::invalid_argument);
+}
+
+TEST_F(StreamTest, WriteUInt32) {
+    std::vector<uint8_t> buffer;
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&buffer);
+    writer.write<uint32_t, D4v3::Borderlands::Common::Streams::big_endian>(0x01020304u);
+    writer.write<uint32_t>(0x01020304u, D4v3::Borderlands::Common::Streams::little_endian);
+
+    const std::vector<uint8_t> expected = {0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 0x02, 0x01};
+    EXPECT_EQ(expected, buffer);
+}
+
+TEST_F(StreamTest, WriteVarint) {
+    std::vector<uint8_t> buffer;
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&buffer);
+    writer.write_varint(8u);
+    writer.write_varint(300u);
+    writer.write_varint(UINT64_MAX);
+
+    const std::vector<uint8_t> expected = {0x08, 0xAC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+    EXPECT_EQ(expected, buffer);
+
+    D4v3::Borderlands::Common::Streams::ByteReader reader(buffer.data(), buffer.size());
+    EXPECT_EQ(8u, reader.read_varint());
+    EXPECT_EQ(300u, reader.read_varint());
+    EXPECT_EQ(UINT64_MAX, reader.read_varint());
+}
+
+TEST_F(StreamTest, WriteReadRoundTrip) {
+    std::vector<uint8_t> buffer;
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&buffer);
+    writer.write<int16_t, D4v3::Borderlands::Common::Streams::big_endian>(-3);
+    writer.write<uint64_t, D4v3::Borderlands::Common::Streams::little_endian>(0x0102030405060708ull);
+    writer.write_bytes("WSG", 3);
+
+    D4v3::Borderlands::Common::Streams::ByteReader reader(buffer.data(), buffer.size());
+    EXPECT_EQ(-3, (reader.read<int16_t, D4v3::Borderlands::Common::Streams::big_endian>()));
+    EXPECT_EQ(0x0102030405060708ull, (reader.read<uint64_t, D4v3::Borderlands::Common::Streams::little_endian>()));
+    EXPECT_EQ(0, memcmp("WSG", reader.read_bytes(3), 3));
+}
+
+TEST_F(StreamTest, ReserveAndPatch) {
+    std::vector<uint8_t> buffer = {0xAA};
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&buffer);
+    size_t size_offset = writer.reserve<uint32_t>();
+    writer.write_bytes("payload", 7);
+    writer.patch<uint32_t, D4v3::Borderlands::Common::Streams::big_endian>(size_offset, (uint32_t) (writer.position() - size_offset - 4));
+
+    EXPECT_EQ(1u, size_offset);
+    EXPECT_EQ(0xAA, buffer[0]);
+    EXPECT_EQ(7, buffer[4]);
+    EXPECT_THROW((writer.patch<uint32_t, D4v3::Borderlands::Common::Streams::big_endian>(buffer.size() - 2, 0)), std::out_of_range);
+}
+
+TEST_F(StreamTest, ReserveAndTruncate) {
+    std::vector<uint8_t> buffer;
+    D4v3::Borderlands::Common::Streams::ByteWriter writer(&buffer);
+    size_t offset = writer.reserve(64);
+    memset(writer.at(offset, 4), 0x11, 4);
+    writer.truncate(offset + 4);
+
+    EXPECT_EQ(4u, buffer.size());
+    EXPECT_EQ(0x11, buffer[3]);
+    EXPECT_THROW(writer.truncate(5), std::out_of_range);
+}
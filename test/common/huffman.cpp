@@ -0,0 +1,103 @@
+//
+// Created by David Oberacker on 2026-10-18.
+//
+
+#include <gtest/gtest.h>
+#include <common/common.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class HuffmanTest : public ::testing::Test {
+protected:
+    HuffmanTest() {
+        // You can do set-up work for each test here.
+    }
+
+    ~HuffmanTest() override {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    /*!
+     * @brief Encodes and decodes the input and returns the decoded bytes.
+     */
+    std::string roundTrip(const std::string &input) {
+        std::vector<uint8_t> encoded;
+        EXPECT_TRUE(D4v3::Borderlands::Common::Huffman::encode(input.data(), (uint32_t) input.size(), &encoded));
+
+        std::string decoded(input.size(), '\0');
+        EXPECT_TRUE(D4v3::Borderlands::Common::Huffman::decode(reinterpret_cast<const char *>(encoded.data()), (uint32_t) encoded.size(), &decoded[0], (int32_t) decoded.size()));
+        return decoded;
+    }
+};
+
+TEST_F(HuffmanTest, RoundTripText) {
+    std::string input = "GD_Assassin.Character.CharClass_Assassin";
+    EXPECT_EQ(input, roundTrip(input));
+}
+
+TEST_F(HuffmanTest, RoundTripSingleSymbol) {
+    std::string input(100, 'x');
+    EXPECT_EQ(input, roundTrip(input));
+}
+
+TEST_F(HuffmanTest, RoundTripAllSymbols) {
+    std::string input;
+    for (int repeat = 0; repeat < 4; ++repeat) {
+        for (int symbol = 0; symbol < 256; ++symbol) {
+            input.push_back((char) symbol);
+        }
+    }
+    EXPECT_EQ(input, roundTrip(input));
+}
+
+TEST_F(HuffmanTest, RoundTripLongCodes) {
+    // Doubling frequencies give codes of up to 15 bits, longer than one table lookup.
+    std::string input;
+    for (int symbol = 0; symbol < 16; ++symbol) {
+        input.append((size_t) 1 << symbol, (char) ('a' + symbol));
+    }
+    std::reverse(input.begin() + input.size() / 2, input.end());
+    EXPECT_EQ(input, roundTrip(input));
+}
+
+TEST_F(HuffmanTest, EncodeSingleSymbolTree) {
+    std::vector<uint8_t> encoded;
+    std::string input(3, 'A');
+    EXPECT_TRUE(D4v3::Borderlands::Common::Huffman::encode(input.data(), (uint32_t) input.size(), &encoded));
+
+    // A single leaf: 1 bit flag + 8 bit symbol, no code bits.
+    ASSERT_EQ(2u, encoded.size());
+    EXPECT_EQ(0xA0, encoded[0]);
+    EXPECT_EQ(0x80, encoded[1]);
+}
+
+TEST_F(HuffmanTest, DecodeRejectsTruncatedInput) {
+    std::string input = "GD_Assassin.Character.CharClass_Assassin";
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(D4v3::Borderlands::Common::Huffman::encode(input.data(), (uint32_t) input.size(), &encoded));
+
+    // Asking for more bytes than were encoded runs into the end of the input.
+    std::string decoded(input.size() * 2, '\0');
+    uint64_t error_offset = 0;
+    EXPECT_FALSE(D4v3::Borderlands::Common::Huffman::decode(reinterpret_cast<const char *>(encoded.data()), (uint32_t) encoded.size(),
+                                                            &decoded[0], (int32_t) decoded.size(), &error_offset));
+    EXPECT_EQ(encoded.size() * 8, error_offset);
+
+    // A tree cut off in the middle of a symbol.
+    EXPECT_FALSE(D4v3::Borderlands::Common::Huffman::decode(reinterpret_cast<const char *>(encoded.data()), 1,
+                                                            &decoded[0], 1, &error_offset));
+    EXPECT_EQ(8u, error_offset);
+}
+
+TEST_F(HuffmanTest, DecodeRejectsOversizedTree) {
+    // Only branch nodes: the tree never ends.
+    std::vector<uint8_t> encoded(128, 0);
+    char decoded = 0;
+    uint64_t error_offset = 0;
+    EXPECT_FALSE(D4v3::Borderlands::Common::Huffman::decode(reinterpret_cast<const char *>(encoded.data()), (uint32_t) encoded.size(),
+                                                            &decoded, 1, &error_offset));
+    // The 256th branch node can not be part of a tree over 256 symbols.
+    EXPECT_EQ(256u, error_offset);
+}